@@ -1,15 +1,17 @@
 # ==== Test config ====
 option(PYRO_PLATFORM_BUILD_TESTS "Build tests" OFF) 
+option(PYRO_PLATFORM_BUILD_BENCHMARKS "Build benchmarks" OFF) 
 option(PYRO_PLATFORM_DUMMY_INTERFACE "Disables implementations. Useful for CI/CD where it's pointless to build the implementation to see if the project builds." OFF) 
 option(PYRO_PLATFORM_SHARED_LIBRARY "Build Platform as shared library" OFF) 
 option(PYRO_PLATFORM_FILE "Include filesystem capabilities (including loading dlls and such)" ON) 
 option(PYRO_PLATFORM_TIME "Include time fuctionalities" ON) 
 option(PYRO_PLATFORM_WINDOWING "Include windowing systems" ON) 
+option(PYRO_PLATFORM_INPUT_INSTRUMENTATION "Time input event dispatch per event type and per handler" OFF) 
 
 if (PYRO_PLATFORM_WINDOWING) 
 	# ==== Windowing Backends ====
 	set(PYRO_PLATFORM_WINDOWING_SYSTEM "GLFW" CACHE STRING "Windowing system")
-	set_property(CACHE PYRO_PLATFORM_WINDOWING_SYSTEM PROPERTY STRINGS "GLFW")
+	set_property(CACHE PYRO_PLATFORM_WINDOWING_SYSTEM PROPERTY STRINGS "GLFW" "Xcb" "Headless")
 
 	message(STATUS "Selected windowing system: ${PYRO_WINDOWING_SYSTEM}")
 	
@@ -22,6 +24,14 @@ if (PYRO_PLATFORM_WINDOWING)
 			add_definitions(-DPYRO_PLATFORM_WINDOWING_GLFW=1)
 			set(PYRO_PLATFORM_WINDOWING_GLFW 1)
 			set(PYRO_PLATFORM_WINDOWING_DIRNAME "Glfw")
+		elseif(PYRO_PLATFORM_WINDOWING_SYSTEM STREQUAL "Xcb")
+			add_definitions(-DPYRO_PLATFORM_WINDOWING_XCB=1)
+			set(PYRO_PLATFORM_WINDOWING_XCB 1)
+			set(PYRO_PLATFORM_WINDOWING_DIRNAME "Xcb")
+		elseif(PYRO_PLATFORM_WINDOWING_SYSTEM STREQUAL "Headless")
+			add_definitions(-DPYRO_PLATFORM_WINDOWING_HEADLESS=1)
+			set(PYRO_PLATFORM_WINDOWING_HEADLESS 1)
+			set(PYRO_PLATFORM_WINDOWING_DIRNAME "Headless")
 		else()
 			message(FATAL_ERROR "Unsupported windowing system: ${PYRO_WINDOWING_SYSTEM}")
 		endif()
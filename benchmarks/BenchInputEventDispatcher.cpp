@@ -0,0 +1,358 @@
+#ifdef PYRO_PLATFORM_WINDOWING
+#include <benchmark/benchmark.h>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
+#include <EASTL/functional.h>
+#include <EASTL/variant.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/GUID.hpp>
+#include <PyroPlatform/Window/Input/CursorPositionEvent.hpp>
+#include <PyroPlatform/Window/Input/InputEventDispatcher.hpp>
+#include <PyroPlatform/Window/InputEventExecutor.hpp>
+#include <PyroPlatform/Window/InputRecording.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowInput.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowManager.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+#include "Stubs/WindowStub.hpp"
+
+using namespace PyroshockStudios;
+using namespace PyroshockStudios::Platform;
+
+namespace {
+    // The dispatcher as it was before the slot map rework, kept as a baseline:
+    // GUID per handler, heap-allocating eastl::function, linear bind/unbind.
+    template <typename Event>
+    class LegacyInputEventHandler {
+    public:
+        LegacyInputEventHandler(const eastl::function<void(Event&)>& fn) : mFn(fn), kHandle(GUID()) {}
+
+        bool operator==(const LegacyInputEventHandler& other) const noexcept {
+            return kHandle == other.kHandle;
+        }
+        void operator()(Event& e) {
+            mFn(e);
+        }
+
+    private:
+        eastl::function<void(Event&)> mFn;
+
+    public:
+        GUID kHandle;
+    };
+
+    template <typename Event>
+    class LegacyInputEventDispatcher {
+    public:
+        void Dispatch(Event& e) {
+            for (LegacyInputEventHandler<Event>& fn : functions) {
+                fn(e);
+            }
+        }
+        bool Bind(const LegacyInputEventHandler<Event>& handler) {
+            if (eastl::find(functions.begin(), functions.end(), handler) != functions.end()) {
+                return false;
+            }
+            functions.emplace_back(handler);
+            return true;
+        }
+        bool Unbind(const LegacyInputEventHandler<Event>& handler) {
+            for (usize i = 0; i < functions.size(); ++i) {
+                if (functions[i] == handler) {
+                    functions.erase(functions.begin() + i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        eastl::vector<LegacyInputEventHandler<Event>> functions;
+    };
+
+    // The dispatcher storage as it was before the type indexed registry: one variant per
+    // event type, every slot padded to the largest alternative and checked on access.
+    using LegacyInputEventMap = eastl::array<
+        eastl::variant<
+            InputEventDispatcher<KeyEvent>,
+            InputEventDispatcher<MouseEvent>,
+            InputEventDispatcher<CursorScrollEvent>,
+            InputEventDispatcher<CursorPositionEvent>,
+            InputEventDispatcher<CursorEnterEvent>,
+            InputEventDispatcher<CharInputEvent>,
+            InputEventDispatcher<WindowCloseEvent>,
+            InputEventDispatcher<WindowFocusEvent>,
+            InputEventDispatcher<WindowPositionEvent>,
+            InputEventDispatcher<WindowResizeEvent>,
+            InputEventDispatcher<TextInputEvent>,
+            InputEventDispatcher<WindowFramebufferResizeEvent>,
+            InputEventDispatcher<WindowContentScaleEvent>,
+            InputEventDispatcher<WindowIconifyEvent>,
+            InputEventDispatcher<WindowMaximizeEvent>,
+            InputEventDispatcher<WindowExposeEvent>,
+            InputEventDispatcher<WindowVisibilityEvent>>,
+        static_cast<usize>(InputEventType::COUNT)>;
+
+    LegacyInputEventMap MakeLegacyInputEventMap() {
+        return {
+            InputEventDispatcher<KeyEvent>(),
+            InputEventDispatcher<MouseEvent>(),
+            InputEventDispatcher<CursorScrollEvent>(),
+            InputEventDispatcher<CursorPositionEvent>(),
+            InputEventDispatcher<CursorEnterEvent>(),
+            InputEventDispatcher<CharInputEvent>(),
+            InputEventDispatcher<WindowCloseEvent>(),
+            InputEventDispatcher<WindowFocusEvent>(),
+            InputEventDispatcher<WindowPositionEvent>(),
+            InputEventDispatcher<WindowResizeEvent>(),
+            InputEventDispatcher<TextInputEvent>(),
+            InputEventDispatcher<WindowFramebufferResizeEvent>(),
+            InputEventDispatcher<WindowContentScaleEvent>(),
+            InputEventDispatcher<WindowIconifyEvent>(),
+            InputEventDispatcher<WindowMaximizeEvent>(),
+            InputEventDispatcher<WindowExposeEvent>(),
+            InputEventDispatcher<WindowVisibilityEvent>()
+        };
+    }
+
+    // stands in for an analytics or logging handler
+    u64 SlowHandlerWork(u64 seed) {
+        for (u32 i = 0; i < 256; ++i) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        return seed;
+    }
+
+    WindowStub gWindowStub = {};
+} // namespace
+
+static void BM_LegacyDispatch(benchmark::State& state) {
+    LegacyInputEventDispatcher<CursorPositionEvent> dispatcher;
+    f64 sum = 0.0;
+    for (i64 i = 0; i < state.range(0); ++i) {
+        dispatcher.Bind({ [&sum](const CursorPositionEvent& e) { sum += e.kX; } });
+    }
+    CursorPositionEvent event(gWindowStub, 1.0, 2.0);
+    for (auto _ : state) {
+        dispatcher.Dispatch(event);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyDispatch)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_Dispatch(benchmark::State& state) {
+    InputEventDispatcher<CursorPositionEvent> dispatcher;
+    f64 sum = 0.0;
+    for (i64 i = 0; i < state.range(0); ++i) {
+        (void)dispatcher.Bind({ [&sum](const CursorPositionEvent& e) { sum += e.kX; } });
+    }
+    CursorPositionEvent event(gWindowStub, 1.0, 2.0);
+    for (auto _ : state) {
+        dispatcher.Dispatch(event);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Dispatch)->Arg(1)->Arg(100)->Arg(10000);
+
+// deep UI stack: the top-most layer consumes 7 out of 8 events, the rest fall through the whole stack.
+// layers are bound bottom-up so every bind goes through the sorted insert.
+static void BM_DispatchDeepStackConsumed(benchmark::State& state) {
+    InputEventDispatcher<CursorPositionEvent> dispatcher;
+    f64 sum = 0.0;
+    for (i64 i = 0; i < state.range(0) - 1; ++i) {
+        (void)dispatcher.Bind({ [&sum](const CursorPositionEvent& e) { sum += e.kX; } }, static_cast<i32>(i));
+    }
+    (void)dispatcher.Bind({ [&sum](CursorPositionEvent& e) {
+        sum += e.kX;
+        if ((static_cast<i64>(e.kY) & 7) != 0) {
+            e.SetHandled();
+        }
+    } },
+        static_cast<i32>(state.range(0)));
+    i64 frame = 0;
+    for (auto _ : state) {
+        CursorPositionEvent event(gWindowStub, 1.0, static_cast<f64>(frame++));
+        dispatcher.Dispatch(event);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchDeepStackConsumed)->Arg(1)->Arg(100)->Arg(10000);
+
+// Bind then unbind one handler among N already bound ones (the UI widget churn case)
+static void BM_LegacyBindUnbind(benchmark::State& state) {
+    LegacyInputEventDispatcher<CursorPositionEvent> dispatcher;
+    for (i64 i = 0; i < state.range(0); ++i) {
+        dispatcher.Bind({ [](const CursorPositionEvent&) {} });
+    }
+    for (auto _ : state) {
+        LegacyInputEventHandler<CursorPositionEvent> handler = { [](const CursorPositionEvent&) {} };
+        dispatcher.Bind(handler);
+        dispatcher.Unbind(handler);
+    }
+}
+BENCHMARK(BM_LegacyBindUnbind)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_BindUnbind(benchmark::State& state) {
+    InputEventDispatcher<CursorPositionEvent> dispatcher;
+    for (i64 i = 0; i < state.range(0); ++i) {
+        (void)dispatcher.Bind({ [](const CursorPositionEvent&) {} });
+    }
+    for (auto _ : state) {
+        InputEventHandle<CursorPositionEvent> handle = dispatcher.Bind({ [](const CursorPositionEvent&) {} });
+        dispatcher.Unbind(handle);
+    }
+}
+BENCHMARK(BM_BindUnbind)->Arg(1)->Arg(100)->Arg(10000);
+
+// Looks the dispatcher up on every event, like WindowEvents does when rebuilding records
+static void BM_LegacyEventMapDispatch(benchmark::State& state) {
+    LegacyInputEventMap events = MakeLegacyInputEventMap();
+    i64 sum = 0;
+    (void)eastl::get<InputEventDispatcher<MouseEvent>>(events[static_cast<usize>(MouseEvent::Type)]).Bind({ [&sum](const MouseEvent& e) { sum += e.kbDown ? 1 : 0; } });
+    for (auto _ : state) {
+        MouseEvent event(gWindowStub, MouseButton::Left, {}, true);
+        eastl::get<InputEventDispatcher<MouseEvent>>(events[static_cast<usize>(MouseEvent::Type)]).Dispatch(event);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["bytes"] = static_cast<f64>(sizeof(LegacyInputEventMap));
+}
+BENCHMARK(BM_LegacyEventMapDispatch);
+
+static void BM_EventRegistryDispatch(benchmark::State& state) {
+    WindowEvents::BuiltinEvents events{};
+    i64 sum = 0;
+    (void)events.Get<MouseEvent>().Bind({ [&sum](const MouseEvent& e) { sum += e.kbDown ? 1 : 0; } });
+    for (auto _ : state) {
+        MouseEvent event(gWindowStub, MouseButton::Left, {}, true);
+        events.Get<MouseEvent>().Dispatch(event);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["bytes"] = static_cast<f64>(sizeof(WindowEvents::BuiltinEvents));
+}
+BENCHMARK(BM_EventRegistryDispatch);
+
+// Main thread cost of a record whose only handler runs inline
+static void BM_DispatchSlowHandlerInline(benchmark::State& state) {
+    WindowEvents events;
+    u64 sum = 0;
+    (void)events.BindEvent<KeyEvent>({ [&sum](const KeyEvent& e) { sum = SlowHandlerWork(sum + e.kScanCode); } });
+    const InputEventRecord record = InputEventRecord::Key(KeyCode::KeyW, 1, {}, true, false);
+    for (auto _ : state) {
+        events.Dispatch(gWindowStub, record);
+    }
+    benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(BM_DispatchSlowHandlerInline);
+
+// Same handler offloaded to a worker thread, the main thread only pushes into the ring
+static void BM_DispatchSlowHandlerOffloaded(benchmark::State& state) {
+    WindowEvents events;
+    InputEventExecutor executor("worker", 1 << 16);
+    u64 sum = 0;
+    (void)executor.BindEvent<KeyEvent>({ [&sum](const KeyEvent& e) { sum = SlowHandlerWork(sum + e.kScanCode); } });
+    executor.Attach(events);
+
+    std::atomic<bool> bRunning = true;
+    std::thread worker([&] {
+        while (bRunning.load(std::memory_order_relaxed)) {
+            if (executor.Run() == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    const InputEventRecord record = InputEventRecord::Key(KeyCode::KeyW, 1, {}, true, false);
+    for (auto _ : state) {
+        events.Dispatch(gWindowStub, record);
+    }
+    bRunning = false;
+    worker.join();
+    executor.Run();
+    benchmark::DoNotOptimize(sum);
+    state.counters["dropped"] = static_cast<f64>(executor.GetRing().GetDroppedCount());
+}
+BENCHMARK(BM_DispatchSlowHandlerOffloaded);
+
+// Replays an input log at maximum speed. Point PYRO_INPUT_RECORDING at a log saved with
+// InputRecorder::SaveToFile to compare builds on a real session, otherwise a synthetic one is used.
+static void BM_ReplayRecording(benchmark::State& state) {
+    eastl::vector<u64> storage;
+    if (const char* path = getenv("PYRO_INPUT_RECORDING")) {
+        if (FILE* file = fopen(path, "rb")) {
+            fseek(file, 0, SEEK_END);
+            const long size = ftell(file);
+            fseek(file, 0, SEEK_SET);
+            storage.resize((static_cast<usize>(size) + sizeof(u64) - 1) / sizeof(u64));
+            storage.resize(fread(storage.data(), 1, static_cast<usize>(size), file) / sizeof(u64));
+            fclose(file);
+        }
+    }
+    if (storage.empty()) {
+        InputRecorder recorder;
+        for (u32 i = 0; i < 10000; ++i) {
+            recorder.Write(0, (i % 16) == 0 ? InputEventRecord::Key(KeyCode::KeyW, 0, {}, (i % 32) == 0, false)
+                                            : InputEventRecord::CursorPosition(static_cast<f64>(i), static_cast<f64>(i), 1.0, 1.0));
+        }
+        const eastl::span<const u8> bytes = recorder.GetBytes();
+        storage.resize((bytes.size() + sizeof(u64) - 1) / sizeof(u64));
+        memcpy(storage.data(), bytes.data(), bytes.size());
+    }
+    InputRecordingView view({ reinterpret_cast<const u8*>(storage.data()), storage.size() * sizeof(u64) });
+    if (!view.IsValid()) {
+        state.SkipWithError("Invalid input recording");
+        return;
+    }
+
+    WindowEvents events;
+    f64 sum = 0.0;
+    (void)events.BindEvent<CursorPositionEvent>({ [&sum](const CursorPositionEvent& e) { sum += e.kX; } });
+    (void)events.BindEvent<KeyEvent>({ [&sum](const KeyEvent& e) { sum += e.kbDown ? 1.0 : 0.0; } });
+    InputPlayer player(view);
+    player.BindWindow(0, gWindowStub, events);
+    for (auto _ : state) {
+        player.Restart();
+        benchmark::DoNotOptimize(player.PlayAll());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<i64>(view.GetEntries().size()));
+}
+BENCHMARK(BM_ReplayRecording);
+
+#ifndef PYRO_PLATFORM_DUMMY_INTERFACE
+// Whole backend path without a display: stamp, snapshot state, merged stream, window dispatch,
+// with one poll per 64 events to publish and drain the stream
+static void BM_HeadlessInjectPoll(benchmark::State& state) {
+    HeadlessWindowManager manager;
+    manager.Init();
+    // no timestamps or latency histograms, only the event path itself
+    manager.InjectClock(nullptr);
+    IWindow* window = manager.CreateWindow({ 1280, 720, "Benchmark" });
+    HeadlessWindowInput* input = static_cast<HeadlessWindow*>(window)->GetHeadlessInput();
+    f64 sum = 0.0;
+    (void)input->GetEvents().BindEvent<CursorPositionEvent>({ [&sum](const CursorPositionEvent& e) { sum += e.kX; } });
+    (void)manager.GetEvents().BindEvent<KeyEvent>({ [&sum](const KeyEvent& e) { sum += e.kbDown ? 1.0 : 0.0; } });
+    u32 i = 0;
+    for (auto _ : state) {
+        if ((i % 16) == 0) {
+            input->InjectKey(KeyCode::KeyW, (i % 32) == 0);
+        } else {
+            input->InjectCursorPosition(static_cast<f64>(i & 1023), static_cast<f64>(i & 511));
+        }
+        if ((++i % 64) == 0) {
+            manager.PollEvents();
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    manager.DestroyWindow(window);
+    manager.Terminate();
+}
+BENCHMARK(BM_HeadlessInjectPoll);
+#endif
+
+#endif
@@ -0,0 +1,2 @@
+#define PYRO_IMPLEMENT_NEW_OPERATOR
+#include <PyroCommon/MemoryOverload.hpp>
@@ -93,10 +93,22 @@
 
 // WINDOWING
 #ifdef PYRO_PLATFORM_WINDOWING
+// always built, it has no dependencies and can replace the selected backend at runtime
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowManager.hpp>
+#include <EASTL/string_view.h>
+#include <cstdlib>
+
 #ifdef PYRO_PLATFORM_WINDOWING_GLFW
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwWindowManager.hpp>
 #define WindowManager GlfwWindowManager
 #endif
+#ifdef PYRO_PLATFORM_WINDOWING_XCB
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+#define WindowManager XcbWindowManager
+#endif
+#ifdef PYRO_PLATFORM_WINDOWING_HEADLESS
+#define WindowManager HeadlessWindowManager
+#endif
 
 #ifndef WindowManager
 #error IWindowManager not implemented!
@@ -149,15 +161,38 @@ namespace PyroshockStudios {
 #ifdef PYRO_PLATFORM_WINDOWING
 #ifndef PYRO_PLATFORM_DUMMY_INTERFACE
         static WindowManager gWindowManager;
+#ifdef PYRO_PLATFORM_WINDOWING_HEADLESS
+        static HeadlessWindowManager& gHeadlessWindowManager = gWindowManager;
+#else
+        static HeadlessWindowManager gHeadlessWindowManager;
+#endif
         template <>
         PYRO_PLATFORM_API IWindowManager* PlatformFactory::Get<IWindowManager>() {
-            return &gWindowManager;
+            // PYRO_PLATFORM_WINDOWING_SYSTEM=Headless in the environment picks the headless backend
+            // without a rebuild, read once so the singleton never changes
+            static IWindowManager* manager = []() -> IWindowManager* {
+                const char* system = std::getenv("PYRO_PLATFORM_WINDOWING_SYSTEM");
+                if (system && eastl::string_view(system) == "Headless") {
+                    return &gHeadlessWindowManager;
+                }
+                return &gWindowManager;
+            }();
+            return manager;
+        }
+        template <>
+        PYRO_PLATFORM_API HeadlessWindowManager* PlatformFactory::Get<HeadlessWindowManager>() {
+            return &gHeadlessWindowManager;
         }
 #else
+        class HeadlessWindowManager;
         template <>
         PYRO_PLATFORM_API IWindowManager* PlatformFactory::Get<IWindowManager>() {
             return nullptr;
         }
+        template <>
+        PYRO_PLATFORM_API HeadlessWindowManager* PlatformFactory::Get<HeadlessWindowManager>() {
+            return nullptr;
+        }
 #endif
 #endif
 
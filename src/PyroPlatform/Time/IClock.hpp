@@ -29,6 +29,10 @@ namespace PyroshockStudios {
             IClock() = default;
             virtual f64 GetTimeElapsed() = 0;
             virtual void SleepMilliseconds(u32 ms) = 0;
+            // Raw monotonic counter, cheap enough to read for every input event
+            virtual u64 GetTicks() = 0;
+            // ticks per second
+            virtual u64 GetTickFrequency() = 0;
         };
     } // namespace Platform
 } // namespace PyroshockStudios
\ No newline at end of file
@@ -38,5 +38,14 @@ namespace PyroshockStudios {
         void UnixClock::SleepMilliseconds(u32 ms) {
             usleep(ms * 1000);
         }
+        u64 UnixClock::GetTicks() {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return static_cast<u64>(now.tv_sec) * 1000000000ull + static_cast<u64>(now.tv_nsec);
+        }
+        u64 UnixClock::GetTickFrequency() {
+            // ticks are nanoseconds
+            return 1000000000ull;
+        }
     } // namespace Platform
 } // namespace PyroshockStudios
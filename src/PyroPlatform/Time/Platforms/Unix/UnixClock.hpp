@@ -34,6 +34,8 @@ namespace PyroshockStudios {
 
             f64 GetTimeElapsed() override;
             void SleepMilliseconds(u32 ms) override;
+            u64 GetTicks() override;
+            u64 GetTickFrequency() override;
 
         private:
             struct timespec mStartTime{};
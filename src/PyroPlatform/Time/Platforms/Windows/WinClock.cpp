@@ -40,5 +40,13 @@ namespace PyroshockStudios {
         void WinClock::SleepMilliseconds(u32 ms) {
             Sleep(static_cast<DWORD>(ms));
         }
+        u64 WinClock::GetTicks() {
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            return static_cast<u64>(now.QuadPart);
+        }
+        u64 WinClock::GetTickFrequency() {
+            return static_cast<u64>(mFrequency);
+        }
     } // namespace Platform
 } // namespace PyroshockStudios
@@ -33,6 +33,8 @@ namespace PyroshockStudios {
 
             f64 GetTimeElapsed() override;
             void SleepMilliseconds(u32 ms) override;
+            u64 GetTicks() override;
+            u64 GetTickFrequency() override;
 
         private:
             long long mStartCount{};
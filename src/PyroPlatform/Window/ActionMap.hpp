@@ -0,0 +1,274 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        using ActionId = u32;
+
+        // A key or mouse button together with the exact modifiers that must be held (a chord).
+        // Caps lock and num lock are ignored when matching. An input with modifiers held that no
+        // chord is bound to falls back to the plain binding, so W still moves while Shift is down.
+        struct ActionBinding {
+            enum struct Source : u8 {
+                Key,
+                Mouse
+            };
+
+            static ActionBinding Key(KeyCode key, InputModifiers::Flags modifiers = 0) {
+                return { Source::Key, static_cast<i32>(key), modifiers };
+            }
+            static ActionBinding Mouse(MouseButton button, InputModifiers::Flags modifiers = 0) {
+                return { Source::Mouse, static_cast<i32>(button), modifiers };
+            }
+
+            Source source = Source::Key;
+            i32 code = 0;
+            InputModifiers::Flags modifiers = 0;
+        };
+
+        // Maps raw key and mouse input to game actions.
+        // Bindings are compiled into a flat table indexed by (code, modifier mask), each cell pointing
+        // at a run of action ids, so resolving an event is a single lookup. Action state lives in a
+        // dense array indexed by ActionId. Every change to the bindings recompiles the table right away,
+        // reusing its buffers, so the input path never rebuilds or allocates anything.
+        class ActionMap : DeleteCopy, DeleteMove {
+        public:
+            static constexpr InputModifiers::Flags kChordModifiers =
+                InputModifiers::Shift | InputModifiers::Control | InputModifiers::Alt | InputModifiers::Super;
+            static constexpr u32 kModifierCombinations = kChordModifiers + 1;
+            static constexpr u32 kKeyCount = static_cast<u32>(KeyCode::Last) + 1;
+            static constexpr u32 kMouseButtonCount = static_cast<u32>(MouseButton::Last) + 1;
+
+            struct ActionState {
+                // number of held bindings, an action stays down while any of them is held
+                u32 heldCount = 0;
+                bool bPressed = false;
+                bool bReleased = false;
+            };
+
+            ActionMap() = default;
+            ~ActionMap() {
+                Detach();
+            }
+
+            void Bind(ActionId action, const ActionBinding& binding) {
+                mBindings.push_back({ action, binding });
+                Compile();
+            }
+            void Unbind(ActionId action) {
+                for (usize i = mBindings.size(); i > 0; --i) {
+                    if (mBindings[i - 1].action == action) {
+                        mBindings.erase(mBindings.begin() + (i - 1));
+                    }
+                }
+                Compile();
+            }
+            void ClearBindings() {
+                mBindings.clear();
+                Compile();
+            }
+
+            // actions the input resolves to, the exact chord or else the plain binding
+            PYRO_NODISCARD eastl::span<const ActionId> Resolve(const ActionBinding& input) const {
+                return ActionsOf(ResolveCell(input.source, input.code, input.modifiers));
+            }
+
+            void HandleKey(KeyCode key, InputModifiers::Flags modifiers, bool bDown, bool bRepeating) {
+                if (!bRepeating) {
+                    HandleInput(ActionBinding::Source::Key, static_cast<i32>(key), modifiers, bDown);
+                }
+            }
+            void HandleMouse(MouseButton button, InputModifiers::Flags modifiers, bool bDown) {
+                HandleInput(ActionBinding::Source::Mouse, static_cast<i32>(button), modifiers, bDown);
+            }
+
+            // Feeds the key and mouse events of the window into the map until Detach()
+            void Attach(WindowEvents& events) {
+                Detach();
+                mEvents = &events;
+                mKeyHandle = events.BindEvent<KeyEvent>({ [this](const KeyEvent& e) {
+                    HandleKey(e.kKey, e.kModifiers, e.kbDown, e.kbRepeating);
+                } });
+                mMouseHandle = events.BindEvent<MouseEvent>({ [this](const MouseEvent& e) {
+                    HandleMouse(e.kButton, e.kModifiers, e.kbDown);
+                } });
+            }
+            void Detach() {
+                if (mEvents != nullptr) {
+                    mEvents->UnbindEvent(mKeyHandle);
+                    mEvents->UnbindEvent(mMouseHandle);
+                    mEvents = nullptr;
+                }
+            }
+
+            PYRO_NODISCARD bool IsDown(ActionId action) const {
+                return action < mStates.size() && mStates[action].heldCount > 0;
+            }
+            PYRO_NODISCARD bool WasPressed(ActionId action) const {
+                return action < mStates.size() && mStates[action].bPressed;
+            }
+            PYRO_NODISCARD bool WasReleased(ActionId action) const {
+                return action < mStates.size() && mStates[action].bReleased;
+            }
+            PYRO_NODISCARD eastl::span<const ActionState> GetStates() const {
+                return { mStates.data(), mStates.size() };
+            }
+            // drops pressed and released edges, call once per frame after reading them
+            void ClearFrame() {
+                for (ActionState& state : mStates) {
+                    state.bPressed = false;
+                    state.bReleased = false;
+                }
+            }
+
+        private:
+            struct BoundAction {
+                ActionId action;
+                ActionBinding binding;
+            };
+
+            static constexpr u32 kKeyCells = kKeyCount * kModifierCombinations;
+            static constexpr u32 kCellCount = kKeyCells + kMouseButtonCount * kModifierCombinations;
+            static constexpr u32 kNoCell = ~0u;
+
+            static u32 CellOf(ActionBinding::Source source, i32 code, InputModifiers::Flags modifiers) {
+                const u32 limit = source == ActionBinding::Source::Key ? kKeyCount : kMouseButtonCount;
+                if (code < 0 || static_cast<u32>(code) >= limit) {
+                    return kNoCell;
+                }
+                const u32 base = source == ActionBinding::Source::Key ? 0 : kKeyCells;
+                return base + static_cast<u32>(code) * kModifierCombinations + (modifiers & kChordModifiers);
+            }
+            eastl::span<const ActionId> ActionsOf(u32 cell) const {
+                if (cell == kNoCell || mCells.empty()) {
+                    return {};
+                }
+                return { mActions.data() + mCells[cell], mCells[cell + 1] - mCells[cell] };
+            }
+            // the exact chord when anything is bound to it, the plain input otherwise
+            u32 ResolveCell(ActionBinding::Source source, i32 code, InputModifiers::Flags modifiers) const {
+                const u32 cell = CellOf(source, code, modifiers);
+                if ((modifiers & kChordModifiers) == 0 || !ActionsOf(cell).empty()) {
+                    return cell;
+                }
+                return CellOf(source, code, 0);
+            }
+
+            // Rebuilds the lookup table, only the binding functions call it
+            void Compile() {
+                ActionId actionCount = 0;
+                for (const BoundAction& bound : mBindings) {
+                    actionCount = bound.action + 1 > actionCount ? bound.action + 1 : actionCount;
+                }
+                mStates.resize(actionCount > mStates.size() ? actionCount : mStates.size());
+
+                // counting pass, then a prefix sum turns the counts into offsets
+                mCells.assign(kCellCount + 1, 0);
+                for (const BoundAction& bound : mBindings) {
+                    const u32 cell = CellOf(bound.binding.source, bound.binding.code, bound.binding.modifiers);
+                    if (cell != kNoCell) {
+                        ++mCells[cell + 1];
+                    }
+                }
+                for (u32 i = 0; i < kCellCount; ++i) {
+                    mCells[i + 1] += mCells[i];
+                }
+                mActions.resize(mCells[kCellCount]);
+                mFill.assign(mCells.begin(), mCells.end() - 1);
+                for (const BoundAction& bound : mBindings) {
+                    const u32 cell = CellOf(bound.binding.source, bound.binding.code, bound.binding.modifiers);
+                    if (cell != kNoCell) {
+                        mActions[mFill[cell]++] = bound.action;
+                    }
+                }
+
+                // Held inputs keep the cell they pressed, recount what they hold in the new table.
+                // Actions whose cells didn't change keep their state, the others get a press or release edge.
+                mPreviousHeld.resize(mStates.size());
+                for (usize action = 0; action < mStates.size(); ++action) {
+                    mPreviousHeld[action] = mStates[action].heldCount;
+                    mStates[action].heldCount = 0;
+                }
+                for (u32 cell : mHeldCells) {
+                    for (ActionId action : ActionsOf(cell)) {
+                        ++mStates[action].heldCount;
+                    }
+                }
+                for (usize action = 0; action < mStates.size(); ++action) {
+                    ActionState& state = mStates[action];
+                    state.bPressed |= mPreviousHeld[action] == 0 && state.heldCount > 0;
+                    state.bReleased |= mPreviousHeld[action] > 0 && state.heldCount == 0;
+                }
+            }
+
+            void HandleInput(ActionBinding::Source source, i32 code, InputModifiers::Flags modifiers, bool bDown) {
+                const u32 slot = source == ActionBinding::Source::Key ? static_cast<u32>(code) : kKeyCount + static_cast<u32>(code);
+                if (code < 0 || slot >= kKeyCount + kMouseButtonCount) {
+                    return;
+                }
+                if (bDown) {
+                    // remember which chord the press resolved to, modifiers may be let go before the key
+                    const u32 cell = ResolveCell(source, code, modifiers);
+                    mHeldCells[slot] = cell;
+                    for (ActionId action : ActionsOf(cell)) {
+                        ActionState& state = mStates[action];
+                        state.bPressed |= state.heldCount++ == 0;
+                    }
+                } else {
+                    const u32 cell = mHeldCells[slot];
+                    mHeldCells[slot] = kNoCell;
+                    for (ActionId action : ActionsOf(cell)) {
+                        ActionState& state = mStates[action];
+                        if (state.heldCount > 0) {
+                            state.bReleased |= --state.heldCount == 0;
+                        }
+                    }
+                }
+            }
+
+            static eastl::array<u32, kKeyCount + kMouseButtonCount> MakeHeldCells() {
+                eastl::array<u32, kKeyCount + kMouseButtonCount> cells;
+                cells.fill(kNoCell);
+                return cells;
+            }
+
+            eastl::vector<BoundAction> mBindings;
+            // mCells[cell]..mCells[cell + 1] is the run of mActions bound to a cell
+            eastl::vector<u32> mCells;
+            eastl::vector<u32> mFill;
+            eastl::vector<ActionId> mActions;
+            eastl::vector<ActionState> mStates;
+            // scratch for Compile(), held counts from before the rebuild
+            eastl::vector<u32> mPreviousHeld;
+            eastl::array<u32, kKeyCount + kMouseButtonCount> mHeldCells = MakeHeldCells();
+            WindowEvents* mEvents = nullptr;
+            InputEventHandle<KeyEvent> mKeyHandle = {};
+            InputEventHandle<MouseEvent> mMouseHandle = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
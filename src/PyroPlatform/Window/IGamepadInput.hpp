@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/span.h>
+#include <EASTL/string_view.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/Input/GamepadState.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // How the arrays of a GamepadDeviceState are laid out
+        enum struct GamepadLayout : u8 {
+            // axes and buttons in GamepadAxis and GamepadButton order, hat 0 as the dpad
+            Default,
+            // already mapped by the backend, axes and buttons in GamepadAxis and GamepadButton order
+            // including the dpad buttons, triggers -1..1
+            Standard,
+            // device specific order, the pad needs a mapping to read anything
+            Unknown
+        };
+
+        // State of one joystick as reported by the device source.
+        // The views only need to stay valid until the next query.
+        struct GamepadDeviceState {
+            // SDL compatible GUID, 32 hex characters
+            eastl::string_view guid = {};
+            eastl::string_view name = {};
+            // -1..1
+            eastl::span<const f32> axes = {};
+            // 0 released, anything else pressed
+            eastl::span<const u8> buttons = {};
+            // bitmask: 1 up, 2 right, 4 down, 8 left
+            eastl::span<const u8> hats = {};
+            GamepadLayout layout = GamepadLayout::Default;
+        };
+
+        // Where the raw joystick data comes from. Backends provide one, tests inject their own.
+        struct IGamepadSource {
+            IGamepadSource() = default;
+
+            PYRO_NODISCARD virtual u32 GetSlotCount() const = 0;
+            // Fills state if a device is connected in the slot
+            virtual bool QueryDevice(u32 slot, GamepadDeviceState& state) = 0;
+
+        protected:
+            virtual ~IGamepadSource() = default;
+        };
+
+        enum struct GamepadResponseCurve : u8 {
+            Linear,
+            Quadratic,
+            Cubic
+        };
+
+        struct IGamepadInput {
+            IGamepadInput() = default;
+
+            // Reads every slot of the source once, maps it and applies deadzones and the response curve.
+            // The window manager calls this from PollEvents() and WaitEvents().
+            virtual void Poll() = 0;
+            PYRO_NODISCARD virtual const GamepadState& GetState() const = 0;
+            PYRO_NODISCARD virtual eastl::string_view GetName(u32 pad) const = 0;
+
+            // Parses SDL style mapping lines ("guid,name,a:b0,leftx:a0,...") into the lookup table,
+            // returns how many mappings were added. Pads the backend already maps are not affected,
+            // pads with an Unknown layout and no mapping report neutral input.
+            virtual u32 AddMappings(eastl::string_view mappings) = 0;
+
+            // Radial deadzone for the sticks, values are fractions of full deflection
+            virtual void SetStickDeadzone(f32 inner, f32 outer) = 0;
+            virtual void SetTriggerDeadzone(f32 inner, f32 outer) = 0;
+            virtual void SetResponseCurve(GamepadResponseCurve curve) = 0;
+
+            virtual void SetSource(IGamepadSource* source) = 0;
+
+        protected:
+            virtual ~IGamepadInput() = default;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -21,13 +21,72 @@
 // SOFTWARE.
 
 #pragma once
+#include <EASTL/span.h>
 #include <EASTL/string.h>
 #include <PyroCommon/Core.hpp>
+#include <numeric>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         struct IWindowManager;
 
+        // Exact refresh rate as a fraction of hertz, 60000/1001 for a 59.94 Hz panel
+        struct RefreshRate {
+            u32 numerator = 0;
+            u32 denominator = 1;
+
+            PYRO_NODISCARD f64 GetHertz() const {
+                return denominator != 0 ? static_cast<f64>(numerator) / static_cast<f64>(denominator) : 0.0;
+            }
+            PYRO_NODISCARD bool IsValid() const {
+                return numerator != 0 && denominator != 0;
+            }
+            bool operator==(const RefreshRate& other) const {
+                return numerator == other.numerator && denominator == other.denominator;
+            }
+
+            static constexpr RefreshRate FromHertz(u32 hertz) {
+                return { hertz, 1 };
+            }
+            // From display mode timings: pixel clock in Hz and the total pixels per line and lines per
+            // frame, blanking included. Interlaced modes show two fields per frame, double scan halves it.
+            static constexpr RefreshRate FromModeTimings(u64 dotClock, u32 hTotal, u32 vTotal, bool bInterlaced, bool bDoubleScan) {
+                u64 numerator = dotClock * (bInterlaced ? 2 : 1);
+                u64 denominator = static_cast<u64>(hTotal) * vTotal * (bDoubleScan ? 2 : 1);
+                if (numerator == 0 || denominator == 0) {
+                    return {};
+                }
+                const u64 divisor = std::gcd(numerator, denominator);
+                numerator /= divisor;
+                denominator /= divisor;
+                // only exotic timings get here, keep as much precision as fits
+                while (numerator > 0xFFFFFFFFull || denominator > 0xFFFFFFFFull) {
+                    numerator >>= 1;
+                    denominator >>= 1;
+                }
+                if (denominator == 0) {
+                    return {};
+                }
+                return { static_cast<u32>(numerator), static_cast<u32>(denominator) };
+            }
+        };
+
+        struct VideoMode {
+            Size resolution = {};
+            u32 refreshRate = 0;
+            u32 redBits = 0;
+            u32 greenBits = 0;
+            u32 blueBits = 0;
+
+            bool operator==(const VideoMode& other) const {
+                return resolution.width == other.resolution.width && resolution.height == other.resolution.height &&
+                       refreshRate == other.refreshRate && redBits == other.redBits &&
+                       greenBits == other.greenBits && blueBits == other.blueBits;
+            }
+        };
+
+        // Properties are cached when the monitor connects and whenever the window manager notices a
+        // change, which it reports as a MonitorEvent. Reading them does not reach the windowing system.
         struct IMonitor {
             IMonitor() = default;
 
@@ -38,6 +97,12 @@ namespace PyroshockStudios {
             PYRO_NODISCARD virtual Size GetWorkArea() const = 0;
             PYRO_NODISCARD virtual FSize GetContentScale() const = 0;
             PYRO_NODISCARD virtual u32 GetRefreshRate() const = 0;
+            // Exact rate of the current mode where the platform exposes its timings (XRandR on Linux),
+            // otherwise the integer rate over 1
+            PYRO_NODISCARD virtual RefreshRate GetPreciseRefreshRate() const = 0;
+            PYRO_NODISCARD virtual VideoMode GetCurrentVideoMode() const = 0;
+            // every mode the monitor supports, sorted from lowest to highest
+            PYRO_NODISCARD virtual eastl::span<const VideoMode> GetVideoModes() const = 0;
 
         protected:
             virtual ~IMonitor() = default;
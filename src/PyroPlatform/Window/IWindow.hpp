@@ -21,6 +21,8 @@
 // SOFTWARE.
 
 #pragma once
+#include <EASTL/algorithm.h>
+#include <EASTL/span.h>
 #include <EASTL/string.h>
 #include <PyroCommon/Core.hpp>
 
@@ -37,12 +39,29 @@ namespace PyroshockStudios {
             Maximized
         };
 
+        // How much of a window the user can see. Only the XCB backend reports partial or full occlusion
+        // by other windows. On X11 both backends report windows the window manager marked hidden
+        // (_NET_WM_STATE_HIDDEN, e.g. on another virtual desktop) as FullyObscured, GLFW notices that
+        // within a quarter second. Elsewhere a mapped window that is not iconified counts as visible.
+        enum struct WindowVisibilityState : i32 {
+            Visible,
+            PartiallyObscured,
+            FullyObscured, // also hidden or unmapped windows
+            Iconified
+        };
+
         enum struct CursorMode : i32 {
             Normal, // Cursor visible, free
             Hidden, // Cursor hidden, free
             Locked  // Cursor locked to window (disabled)
         };
 
+        // The pointer goes negative left of or above the window (while dragging), the cached
+        // cursor position clamps to 0 there. Events keep the unclamped coordinates.
+        PYRO_NODISCARD PYRO_FORCEINLINE Point ToCursorPoint(f64 x, f64 y) {
+            return Point(static_cast<u32>(x > 0.0 ? x : 0.0), static_cast<u32>(y > 0.0 ? y : 0.0));
+        }
+
         struct WindowCreateFlagsProperties {
             using Data = u32;
         };
@@ -61,6 +80,32 @@ namespace PyroshockStudios {
                 RESIZABLE | DECORATED | VISIBLE | FOCUSED;
         };
 
+        // Area of a window in pixels, from the top left corner
+        struct WindowRect {
+            i32 x = 0;
+            i32 y = 0;
+            u32 width = 0;
+            u32 height = 0;
+
+            PYRO_NODISCARD bool IsEmpty() const {
+                return width == 0 || height == 0;
+            }
+            // the part that lies within (0, 0, bounds)
+            PYRO_NODISCARD WindowRect Clipped(Size bounds) const {
+                const i64 left = eastl::max<i64>(x, 0);
+                const i64 top = eastl::max<i64>(y, 0);
+                const i64 right = eastl::min<i64>(static_cast<i64>(x) + width, bounds.width);
+                const i64 bottom = eastl::min<i64>(static_cast<i64>(y) + height, bounds.height);
+                if (right <= left || bottom <= top) {
+                    return {};
+                }
+                return { static_cast<i32>(left), static_cast<i32>(top), static_cast<u32>(right - left), static_cast<u32>(bottom - top) };
+            }
+            bool operator==(const WindowRect& other) const {
+                return x == other.x && y == other.y && width == other.width && height == other.height;
+            }
+        };
+
         struct WindowInfo {
             u32 width = 0;
             u32 height = 0;
@@ -134,15 +179,27 @@ namespace PyroshockStudios {
             PYRO_NODISCARD virtual bool ShouldClose() const = 0;
             PYRO_NODISCARD virtual bool IsFocused() const = 0;
             PYRO_NODISCARD virtual bool IsHovered() const = 0;
+            // changes are reported as a WindowVisibilityEvent
+            PYRO_NODISCARD virtual WindowVisibilityState GetVisibilityState() const = 0;
+
+            // Re-reads every cached property (size, position, focus, ...) from the windowing system.
+            // The getters return the values of the last processed events, call this when that is not enough.
+            virtual void Refresh() = 0;
 
             PYRO_NODISCARD virtual IWindowInput* GetInputHandler() = 0;
 
+            // Draws a CPU rendered image at the top left of the window, for software renderers that
+            // have no GPU context. Pixels are 32 bit 0xXXRRGGBB in native byte order and rows are
+            // `stride` bytes apart. Only the dirty rectangles are uploaded, none means all of it.
+            // Returns false if the backend can't present pixels (GLFW outside of X11).
+            virtual bool PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects = {}) = 0;
+
             // HWND on windows
-            // Window* on X11
+            // Window* on X11, the xcb_window_t on the XCB backend
             PYRO_NODISCARD virtual NativeHandle GetNativeWindow() const = 0;
 
             // HINSTANCE on windows
-            // Display* on X11
+            // Display* on X11, the xcb_connection_t* on the XCB backend
             PYRO_NODISCARD virtual NativeHandle GetNativeInstance() const = 0;
 
         protected:
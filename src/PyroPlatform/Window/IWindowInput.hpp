@@ -21,7 +21,9 @@
 // SOFTWARE.
 
 #pragma once
-#include <PyroCommon/Types.hpp>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/Input/InputEvent.hpp>
+#include <PyroPlatform/Window/Input/InputSnapshot.hpp>
 #include <PyroPlatform/Window/Input/Types.hpp>
 
 namespace PyroshockStudios {
@@ -31,11 +33,35 @@ namespace PyroshockStudios {
         struct IWindowInput {
             IWindowInput() = default;
 
+            // State queries read the snapshot published by the last IWindowManager::PollEvents()
+            // or WaitEvents(), so they are a bit test and stay consistent for the whole frame.
+            // They belong to the thread polling events, other threads take a GetSnapshot() copy.
             virtual bool IsKeyDown(KeyCode key) = 0;
             virtual bool IsMouseDown(MouseButton button) = 0;
+            PYRO_NODISCARD virtual bool WasPressed(KeyCode key) const = 0;
+            PYRO_NODISCARD virtual bool WasReleased(KeyCode key) const = 0;
+            PYRO_NODISCARD virtual bool WasPressed(MouseButton button) const = 0;
+            PYRO_NODISCARD virtual bool WasReleased(MouseButton button) const = 0;
+            // Copy of the published state, safe to take from any thread. A copy racing a publish
+            // is retried, so it always holds one whole frame.
+            PYRO_NODISCARD virtual InputSnapshot GetSnapshot() const = 0;
+            // Publishes the state gathered since the last call and starts a new frame.
+            // Called by the window manager after polling, only call it yourself when driving events manually.
+            virtual void PublishSnapshot() = 0;
 
             virtual WindowEvents& GetEvents() = 0;
 
+            // When buffered, window callbacks only record events into a ring buffer and
+            // nothing is dispatched until DrainEvents() is called.
+            virtual void SetBufferedEvents(bool bBuffered) = 0;
+            PYRO_NODISCARD virtual bool IsBufferedEvents() const = 0;
+            // Dispatches all buffered events of this window in arrival order
+            virtual void DrainEvents() = 0;
+            // Opt-in merging of buffered cursor motion, scroll, window position and resize events,
+            // see InputEventQueue. Only applies while events are buffered.
+            virtual void SetEventCoalescing(InputEventType type, bool bEnabled) = 0;
+            PYRO_NODISCARD virtual u64 GetCoalescedCount(InputEventType type) const = 0;
+
         protected:
             virtual ~IWindowInput() = default;
             friend struct IWindow;
@@ -26,13 +26,17 @@
 #include <EASTL/span.h>
 #include <PyroCommon/Types.hpp>
 #include <PyroCommon/LoggerInterface.hpp>
+#include <PyroPlatform/Time/IClock.hpp>
 #include <PyroPlatform/Window/ICursor.hpp>
+#include <PyroPlatform/Window/IGamepadInput.hpp>
 #include <PyroPlatform/Window/IMonitor.hpp>
 #include <PyroPlatform/Window/IWindow.hpp>
 #include <PyroPlatform/Window/Input/Types.hpp>
 
 namespace PyroshockStudios {
     inline namespace Platform {
+        class WindowEvents;
+
         enum struct KeySource {
             Physical, // Layout-independent
             Logical   // Layout-dependent (after translation)
@@ -44,8 +48,19 @@ namespace PyroshockStudios {
             virtual bool Init() = 0;
             virtual bool Terminate() = 0;
 
+            // Both also publish every window's input snapshot once the events are in
             virtual void PollEvents() = 0;
             virtual void WaitEvents() = 0;
+            // Dispatches the buffered events of every window, interleaved in arrival order.
+            // Only has an effect on windows with buffered events enabled.
+            virtual void DrainEvents() = 0;
+            // Clock used to timestamp input events and measure their latency. Defaults to the
+            // platform clock when time support is built in, null disables timestamps.
+            virtual void InjectClock(IClock* clock) = 0;
+            // Events of every window merged into one stream ordered by timestamp, the sender of each
+            // event is the window it came from. Delivered at the end of every PollEvents()/WaitEvents().
+            // MonitorEvents are emitted here too, as soon as the change is noticed.
+            PYRO_NODISCARD virtual WindowEvents& GetEvents() = 0;
 
             PYRO_NODISCARD virtual bool HasClipboardText() = 0;
             PYRO_NODISCARD virtual eastl::string GetClipboardText() = 0;
@@ -53,6 +68,14 @@ namespace PyroshockStudios {
 
             virtual eastl::span<IMonitor*> GetMonitors() = 0;
             virtual IMonitor* GetPrimaryMonitor() = 0;
+            // The fullscreen monitor of the window, otherwise the one it overlaps the most. Uses cached state only.
+            PYRO_NODISCARD virtual IMonitor* GetMonitorForWindow(IWindow* window) = 0;
+            // Re-reads the properties of every monitor and emits a MonitorEvent for each one that changed.
+            // Happens on its own on hotplug and when a window's content scale changes.
+            virtual void RefreshMonitors() = 0;
+
+            // Polled once per PollEvents()/WaitEvents()
+            PYRO_NODISCARD virtual IGamepadInput* GetGamepadInput() = 0;
 
             PYRO_NODISCARD virtual IWindow* CreateWindow(const WindowInfo& info) = 0;
             virtual void DestroyWindow(IWindow*& window) = 0;
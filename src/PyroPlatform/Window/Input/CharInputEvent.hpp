@@ -22,43 +22,27 @@
 
 #pragma once
 #include "InputEvent.hpp"
+#include "Utf8.hpp"
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class CharInputEvent : public InputEvent<InputEventType::CharInput> {
         public:
+            static constexpr eastl::string_view kName = "CharInputEvent";
+
             CharInputEvent(IWindow& sender, u32 unicode)
                 : InputEvent(sender), kUnicode(unicode) {}
 
             InputEventType GetType() const override {
                 return InputEventType::CharInput;
             }
-            eastl::string GetName() const override {
-                return "CharInputEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                eastl::string result = {};
-
-                if (kUnicode <= 0x7F) {
-                    result += static_cast<char>(kUnicode);
-                } else if (kUnicode <= 0x7FF) {
-                    result += static_cast<char>(0xC0 | ((kUnicode >> 6) & 0x1F));
-                    result += static_cast<char>(0x80 | (kUnicode & 0x3F));
-                } else if (kUnicode <= 0xFFFF) {
-                    result += static_cast<char>(0xE0 | ((kUnicode >> 12) & 0x0F));
-                    result += static_cast<char>(0x80 | ((kUnicode >> 6) & 0x3F));
-                    result += static_cast<char>(0x80 | (kUnicode & 0x3F));
-                } else if (kUnicode <= 0x10FFFF) {
-                    result += static_cast<char>(0xF0 | ((kUnicode >> 18) & 0x07));
-                    result += static_cast<char>(0x80 | ((kUnicode >> 12) & 0x3F));
-                    result += static_cast<char>(0x80 | ((kUnicode >> 6) & 0x3F));
-                    result += static_cast<char>(0x80 | (kUnicode & 0x3F));
-                } else {
-                    // Invalid code point
-                    result += '?'; // or replacement character: 0xEF 0xBF 0xBD
-                }
-
-                return "Char Typed: " + result;
+            usize FormatTo(char* buffer, usize capacity) const override {
+                char utf8[kMaxUtf8Bytes + 1] = {};
+                EncodeUtf8(kUnicode, utf8);
+                return Format(buffer, capacity, "Char Typed: %s", utf8);
             }
 
             const u32 kUnicode;
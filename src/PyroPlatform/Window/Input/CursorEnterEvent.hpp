@@ -22,12 +22,13 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class CursorEnterEvent : public InputEvent<InputEventType::CursorEnter> {
         public:
+            static constexpr eastl::string_view kName = "CursorEnterEvent";
+
             CursorEnterEvent(IWindow& sender, bool bEntered)
                 : InputEvent(sender), kbEntered(bEntered) {
             }
@@ -35,11 +36,11 @@ namespace PyroshockStudios {
             InputEventType GetType() const override {
                 return InputEventType::CursorEnter;
             }
-            eastl::string GetName() const override {
-                return "CursorEnterEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                return eastl::string("Cursor ") + (kbEntered ? "Enter" : "Left");
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Cursor %s", kbEntered ? "Enter" : "Left");
             }
 
             const bool kbEntered = false;
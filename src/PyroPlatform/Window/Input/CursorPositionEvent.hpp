@@ -22,29 +22,31 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class CursorPositionEvent : public InputEvent<InputEventType::CursorPosition> {
         public:
-            CursorPositionEvent(IWindow& sender, f64 x, f64 y)
-                : InputEvent(sender), kX(x), kY(y) {}
+            static constexpr eastl::string_view kName = "CursorPositionEvent";
+
+            CursorPositionEvent(IWindow& sender, f64 x, f64 y, f64 deltaX = 0.0, f64 deltaY = 0.0)
+                : InputEvent(sender), kX(x), kY(y), kDeltaX(deltaX), kDeltaY(deltaY) {}
 
             InputEventType GetType() const override {
                 return InputEventType::CursorPosition;
             }
-            eastl::string GetName() const override {
-                return "CursorPositionEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[64] = {};
-                snprintf(buff, 64, "(%.2lf, %.2lf)", kX, kY);
-                return "Cursor Position : " + eastl::string(buff);
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Cursor Position : (%.2lf, %.2lf)", kX, kY);
             }
 
             const f64 kX;
             const f64 kY;
+            // movement since the previous position event, covers every merged motion when coalescing
+            const f64 kDeltaX;
+            const f64 kDeltaY;
         };
     } // namespace Platform
 } // namespace PyroshockStudios
\ No newline at end of file
@@ -22,25 +22,24 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class CursorScrollEvent : public InputEvent<InputEventType::CursorScroll> {
         public:
+            static constexpr eastl::string_view kName = "CursorScrollEvent";
+
             CursorScrollEvent(IWindow& sender, f64 x, f64 y)
                 : InputEvent(sender), kX(x), kY(y) {}
 
             InputEventType GetType() const override {
                 return InputEventType::CursorScroll;
             }
-            eastl::string GetName() const override {
-                return "CursorScrollEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[64] = {};
-                snprintf(buff, 64, "(%.2lf, %.2lf)", kX, kY);
-                return "Cursor Scroll : " + eastl::string(buff);
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Cursor Scroll : (%.2lf, %.2lf)", kX, kY);
             }
 
             const f64 kX;
@@ -0,0 +1,171 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "GamepadInput.hpp"
+#include <EASTL/algorithm.h>
+#include <cmath>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            constexpr u32 kPads = GamepadState::kMaxGamepads;
+
+            f32 Clamp01(f32 value) {
+                value = value < 0.0f ? 0.0f : value;
+                return value > 1.0f ? 1.0f : value;
+            }
+            template <u32 Power>
+            f32 Curve(f32 value) {
+                f32 result = value;
+                for (u32 i = 1; i < Power; ++i) {
+                    result *= value;
+                }
+                return result;
+            }
+
+            // The shaping loops run over every slot with no per pad branches, so the compiler
+            // turns them into straight SIMD over the axis arrays.
+            template <u32 Power>
+            void ShapeStick(f32* __restrict xs, f32* __restrict ys, f32 inner, f32 outer) {
+                const f32 scale = 1.0f / (outer - inner);
+                for (u32 i = 0; i < kPads; ++i) {
+                    const f32 x = xs[i];
+                    const f32 y = ys[i];
+                    const f32 magnitude = sqrtf(x * x + y * y);
+                    const f32 scaled = Clamp01((magnitude - inner) * scale);
+                    // radial: keep the direction, remap the length
+                    const f32 gain = Curve<Power>(scaled) / (magnitude > 1e-6f ? magnitude : 1e-6f);
+                    xs[i] = x * gain;
+                    ys[i] = y * gain;
+                }
+            }
+            template <u32 Power>
+            void ShapeTrigger(f32* __restrict values, f32 inner, f32 outer) {
+                const f32 scale = 1.0f / (outer - inner);
+                for (u32 i = 0; i < kPads; ++i) {
+                    values[i] = Curve<Power>(Clamp01((values[i] - inner) * scale));
+                }
+            }
+            template <u32 Power>
+            void ShapeAll(GamepadState& state, f32 stickInner, f32 stickOuter, f32 triggerInner, f32 triggerOuter) {
+                ShapeStick<Power>(state.axes[static_cast<u32>(GamepadAxis::LeftX)], state.axes[static_cast<u32>(GamepadAxis::LeftY)], stickInner, stickOuter);
+                ShapeStick<Power>(state.axes[static_cast<u32>(GamepadAxis::RightX)], state.axes[static_cast<u32>(GamepadAxis::RightY)], stickInner, stickOuter);
+                ShapeTrigger<Power>(state.axes[static_cast<u32>(GamepadAxis::LeftTrigger)], triggerInner, triggerOuter);
+                ShapeTrigger<Power>(state.axes[static_cast<u32>(GamepadAxis::RightTrigger)], triggerInner, triggerOuter);
+            }
+        } // namespace
+
+        GamepadInput::GamepadInput(IGamepadSource* source) : mSource(source) {
+        }
+
+        void GamepadInput::Poll() {
+            mState.previousButtons = mState.buttons;
+            const u32 previousConnected = mState.connectedMask;
+            mState.connectedMask = 0;
+            const u32 slots = mSource ? eastl::min(mSource->GetSlotCount(), kPads) : 0;
+            for (u32 pad = 0; pad < kPads; ++pad) {
+                GamepadDeviceState device = {};
+                if (pad >= slots || !mSource->QueryDevice(pad, device)) {
+                    for (u32 axis = 0; axis < GamepadState::kAxisCount; ++axis) {
+                        mState.axes[axis][pad] = 0.0f;
+                    }
+                    mState.buttons[pad] = 0;
+                    mMappings[pad] = nullptr;
+                    continue;
+                }
+                mState.connectedMask |= 1u << pad;
+                if (bRemap || (previousConnected & (1u << pad)) == 0 || mMappings[pad] == nullptr) {
+                    mMappings[pad] = ResolveMapping(device);
+                    mNames[pad].assign(device.name.data(), device.name.size());
+                }
+                ReadDevice(pad, device);
+            }
+            bRemap = false;
+            Shape();
+        }
+        eastl::string_view GamepadInput::GetName(u32 pad) const {
+            if (!mState.IsConnected(pad)) {
+                return {};
+            }
+            return { mNames[pad].data(), mNames[pad].size() };
+        }
+
+        u32 GamepadInput::AddMappings(eastl::string_view mappings) {
+            const u32 added = mDatabase.AddMappings(mappings);
+            // pads that are already connected pick the new mappings up on the next poll
+            bRemap |= added != 0;
+            return added;
+        }
+
+        void GamepadInput::SetStickDeadzone(f32 inner, f32 outer) {
+            mStickInner = inner;
+            mStickOuter = outer > inner ? outer : inner + 1e-3f;
+        }
+        void GamepadInput::SetTriggerDeadzone(f32 inner, f32 outer) {
+            mTriggerInner = inner;
+            mTriggerOuter = outer > inner ? outer : inner + 1e-3f;
+        }
+        void GamepadInput::SetResponseCurve(GamepadResponseCurve curve) {
+            mCurve = curve;
+        }
+        void GamepadInput::SetSource(IGamepadSource* source) {
+            mSource = source;
+            mState = {};
+            mMappings = {};
+        }
+
+        const GamepadMapping* GamepadInput::ResolveMapping(const GamepadDeviceState& device) const {
+            if (device.layout == GamepadLayout::Standard) {
+                return &mStandardMapping;
+            }
+            if (const GamepadMapping* mapping = mDatabase.Find(device.guid)) {
+                return mapping;
+            }
+            return device.layout == GamepadLayout::Default ? &mDefaultMapping : &mUnmapped;
+        }
+
+        void GamepadInput::ReadDevice(u32 pad, const GamepadDeviceState& device) {
+            const GamepadMapping& mapping = *mMappings[pad];
+            for (u32 axis = 0; axis < GamepadState::kAxisCount; ++axis) {
+                mState.axes[axis][pad] = mapping.ReadAxis(static_cast<GamepadAxis>(axis), device);
+            }
+            u32 buttons = 0;
+            for (u32 button = 0; button < GamepadState::kButtonCount; ++button) {
+                buttons |= mapping.ReadButton(static_cast<GamepadButton>(button), device) ? 1u << button : 0u;
+            }
+            mState.buttons[pad] = buttons;
+        }
+        void GamepadInput::Shape() {
+            switch (mCurve) {
+            case GamepadResponseCurve::Linear:
+                ShapeAll<1>(mState, mStickInner, mStickOuter, mTriggerInner, mTriggerOuter);
+                break;
+            case GamepadResponseCurve::Quadratic:
+                ShapeAll<2>(mState, mStickInner, mStickOuter, mTriggerInner, mTriggerOuter);
+                break;
+            case GamepadResponseCurve::Cubic:
+                ShapeAll<3>(mState, mStickInner, mStickOuter, mTriggerInner, mTriggerOuter);
+                break;
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/array.h>
+#include <EASTL/string.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IGamepadInput.hpp>
+#include <PyroPlatform/Window/Input/GamepadMapping.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Backend independent IGamepadInput on top of an IGamepadSource
+        class GamepadInput : public IGamepadInput, DeleteCopy, DeleteMove {
+        public:
+            GamepadInput(IGamepadSource* source = nullptr);
+            ~GamepadInput() override = default;
+
+            void Poll() override;
+            const GamepadState& GetState() const override {
+                return mState;
+            }
+            eastl::string_view GetName(u32 pad) const override;
+
+            u32 AddMappings(eastl::string_view mappings) override;
+
+            void SetStickDeadzone(f32 inner, f32 outer) override;
+            void SetTriggerDeadzone(f32 inner, f32 outer) override;
+            void SetResponseCurve(GamepadResponseCurve curve) override;
+
+            void SetSource(IGamepadSource* source) override;
+
+        private:
+            const GamepadMapping* ResolveMapping(const GamepadDeviceState& device) const;
+            void ReadDevice(u32 pad, const GamepadDeviceState& device);
+            void Shape();
+
+            IGamepadSource* mSource = nullptr;
+            GamepadState mState = {};
+            GamepadMappingDatabase mDatabase = {};
+            const GamepadMapping mDefaultMapping = GamepadMapping::Default();
+            const GamepadMapping mStandardMapping = GamepadMapping::Standard();
+            // every source None, reads as released and centred
+            const GamepadMapping mUnmapped = {};
+            // resolved on connect, not per poll
+            eastl::array<const GamepadMapping*, GamepadState::kMaxGamepads> mMappings = {};
+            eastl::array<eastl::string, GamepadState::kMaxGamepads> mNames = {};
+            f32 mStickInner = 0.15f;
+            f32 mStickOuter = 0.95f;
+            f32 mTriggerInner = 0.05f;
+            f32 mTriggerOuter = 0.98f;
+            GamepadResponseCurve mCurve = GamepadResponseCurve::Linear;
+            bool bRemap = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
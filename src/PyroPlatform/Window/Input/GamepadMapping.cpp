@@ -0,0 +1,259 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "GamepadMapping.hpp"
+#include <PyroPlatform/Window/IGamepadInput.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            struct NamedOutput {
+                eastl::string_view name;
+                bool bAxis;
+                u32 index;
+            };
+            constexpr NamedOutput kOutputs[] = {
+                { "a", false, static_cast<u32>(GamepadButton::A) },
+                { "b", false, static_cast<u32>(GamepadButton::B) },
+                { "x", false, static_cast<u32>(GamepadButton::X) },
+                { "y", false, static_cast<u32>(GamepadButton::Y) },
+                { "leftshoulder", false, static_cast<u32>(GamepadButton::LeftBumper) },
+                { "rightshoulder", false, static_cast<u32>(GamepadButton::RightBumper) },
+                { "back", false, static_cast<u32>(GamepadButton::Back) },
+                { "start", false, static_cast<u32>(GamepadButton::Start) },
+                { "guide", false, static_cast<u32>(GamepadButton::Guide) },
+                { "leftstick", false, static_cast<u32>(GamepadButton::LeftThumb) },
+                { "rightstick", false, static_cast<u32>(GamepadButton::RightThumb) },
+                { "dpup", false, static_cast<u32>(GamepadButton::DpadUp) },
+                { "dpright", false, static_cast<u32>(GamepadButton::DpadRight) },
+                { "dpdown", false, static_cast<u32>(GamepadButton::DpadDown) },
+                { "dpleft", false, static_cast<u32>(GamepadButton::DpadLeft) },
+                { "leftx", true, static_cast<u32>(GamepadAxis::LeftX) },
+                { "lefty", true, static_cast<u32>(GamepadAxis::LeftY) },
+                { "rightx", true, static_cast<u32>(GamepadAxis::RightX) },
+                { "righty", true, static_cast<u32>(GamepadAxis::RightY) },
+                { "lefttrigger", true, static_cast<u32>(GamepadAxis::LeftTrigger) },
+                { "righttrigger", true, static_cast<u32>(GamepadAxis::RightTrigger) },
+            };
+
+#if defined(PYRO_PLATFORM_WINDOWS)
+            constexpr eastl::string_view kPlatformName = "Windows";
+#elif defined(PYRO_PLATFORM_MACOS)
+            constexpr eastl::string_view kPlatformName = "Mac OS X";
+#elif defined(PYRO_PLATFORM_LINUX)
+            constexpr eastl::string_view kPlatformName = "Linux";
+#else
+            constexpr eastl::string_view kPlatformName = "";
+#endif
+
+            // splits off the text up to the separator, advancing the input past it
+            eastl::string_view NextToken(eastl::string_view& text, char separator) {
+                const usize end = text.find(separator);
+                const eastl::string_view token = text.substr(0, end);
+                text = end == eastl::string_view::npos ? eastl::string_view() : text.substr(end + 1);
+                return token;
+            }
+            bool ParseNumber(eastl::string_view text, u32& out) {
+                if (text.empty()) {
+                    return false;
+                }
+                out = 0;
+                for (char c : text) {
+                    if (c < '0' || c > '9') {
+                        return false;
+                    }
+                    out = out * 10 + static_cast<u32>(c - '0');
+                }
+                return out <= 0xFF;
+            }
+            // "b3", "a1", "+a2", "-a2", "a1~", "h0.4"
+            bool ParseSource(eastl::string_view text, GamepadMapping::Source& out) {
+                out = {};
+                if (!text.empty() && (text.front() == '+' || text.front() == '-')) {
+                    out.half = text.front() == '+' ? 1 : -1;
+                    text.remove_prefix(1);
+                }
+                if (!text.empty() && text.back() == '~') {
+                    out.bInvert = true;
+                    text.remove_suffix(1);
+                }
+                if (text.size() < 2) {
+                    return false;
+                }
+                const char kind = text.front();
+                text.remove_prefix(1);
+                u32 index = 0;
+                switch (kind) {
+                case 'b':
+                    out.type = GamepadMapping::Source::Type::Button;
+                    break;
+                case 'a':
+                    out.type = GamepadMapping::Source::Type::Axis;
+                    break;
+                case 'h': {
+                    out.type = GamepadMapping::Source::Type::Hat;
+                    u32 mask = 0;
+                    const eastl::string_view hat = NextToken(text, '.');
+                    if (!ParseNumber(hat, index) || !ParseNumber(text, mask)) {
+                        return false;
+                    }
+                    out.index = static_cast<u8>(index);
+                    out.hatMask = static_cast<u8>(mask);
+                    return true;
+                }
+                default:
+                    return false;
+                }
+                if (!ParseNumber(text, index)) {
+                    return false;
+                }
+                out.index = static_cast<u8>(index);
+                return true;
+            }
+
+            f32 ReadRaw(const GamepadMapping::Source& source, const GamepadDeviceState& device) {
+                f32 value = 0.0f;
+                switch (source.type) {
+                case GamepadMapping::Source::Type::Button:
+                    value = source.index < device.buttons.size() && device.buttons[source.index] != 0 ? 1.0f : 0.0f;
+                    break;
+                case GamepadMapping::Source::Type::Hat:
+                    value = source.index < device.hats.size() && (device.hats[source.index] & source.hatMask) != 0 ? 1.0f : 0.0f;
+                    break;
+                case GamepadMapping::Source::Type::Axis:
+                    value = source.index < device.axes.size() ? device.axes[source.index] : 0.0f;
+                    if (source.half != 0) {
+                        // half axes are rescaled so the used half covers 0..1
+                        value *= static_cast<f32>(source.half);
+                        value = value < 0.0f ? 0.0f : value;
+                    }
+                    break;
+                default:
+                    break;
+                }
+                return source.bInvert ? -value : value;
+            }
+        } // namespace
+
+        bool GamepadMapping::ReadButton(GamepadButton button, const GamepadDeviceState& device) const {
+            return ReadRaw(buttons[static_cast<usize>(button)], device) > 0.5f;
+        }
+        f32 GamepadMapping::ReadAxis(GamepadAxis axis, const GamepadDeviceState& device) const {
+            const Source& source = axes[static_cast<usize>(axis)];
+            const f32 value = ReadRaw(source, device);
+            const bool bTrigger = axis == GamepadAxis::LeftTrigger || axis == GamepadAxis::RightTrigger;
+            if (bTrigger && source.type == Source::Type::Axis && source.half == 0) {
+                // full range axis driving a trigger, -1 is released
+                return (value + 1.0f) * 0.5f;
+            }
+            return value;
+        }
+        GamepadMapping GamepadMapping::Default() {
+            GamepadMapping mapping = {};
+            for (u32 i = 0; i < static_cast<u32>(GamepadAxis::COUNT); ++i) {
+                mapping.axes[i] = { Source::Type::Axis, static_cast<u8>(i) };
+            }
+            for (u32 i = 0; i < static_cast<u32>(GamepadButton::DpadUp); ++i) {
+                mapping.buttons[i] = { Source::Type::Button, static_cast<u8>(i) };
+            }
+            mapping.buttons[static_cast<usize>(GamepadButton::DpadUp)] = { Source::Type::Hat, 0, 1 };
+            mapping.buttons[static_cast<usize>(GamepadButton::DpadRight)] = { Source::Type::Hat, 0, 2 };
+            mapping.buttons[static_cast<usize>(GamepadButton::DpadDown)] = { Source::Type::Hat, 0, 4 };
+            mapping.buttons[static_cast<usize>(GamepadButton::DpadLeft)] = { Source::Type::Hat, 0, 8 };
+            return mapping;
+        }
+        GamepadMapping GamepadMapping::Standard() {
+            GamepadMapping mapping = {};
+            for (u32 i = 0; i < static_cast<u32>(GamepadAxis::COUNT); ++i) {
+                mapping.axes[i] = { Source::Type::Axis, static_cast<u8>(i) };
+            }
+            for (u32 i = 0; i < static_cast<u32>(GamepadButton::COUNT); ++i) {
+                mapping.buttons[i] = { Source::Type::Button, static_cast<u8>(i) };
+            }
+            return mapping;
+        }
+
+        u32 GamepadMappingDatabase::AddMappings(eastl::string_view mappings) {
+            u32 added = 0;
+            while (!mappings.empty()) {
+                eastl::string_view line = NextToken(mappings, '\n');
+                if (!line.empty() && line.back() == '\r') {
+                    line.remove_suffix(1);
+                }
+                if (line.empty() || line.front() == '#') {
+                    continue;
+                }
+                u64 guidHash = 0;
+                GamepadMapping mapping = {};
+                if (ParseMapping(line, guidHash, mapping)) {
+                    mMappings[guidHash] = mapping;
+                    ++added;
+                }
+            }
+            return added;
+        }
+        const GamepadMapping* GamepadMappingDatabase::Find(eastl::string_view guid) const {
+            const auto it = mMappings.find(HashGuid(guid));
+            return it != mMappings.end() ? &it->second : nullptr;
+        }
+
+        bool GamepadMappingDatabase::ParseMapping(eastl::string_view line, u64& outGuidHash, GamepadMapping& outMapping) {
+            const eastl::string_view guid = NextToken(line, ',');
+            const eastl::string_view name = NextToken(line, ',');
+            if (guid.empty() || name.empty()) {
+                return false;
+            }
+            outMapping = {};
+            while (!line.empty()) {
+                eastl::string_view value = NextToken(line, ',');
+                const eastl::string_view key = NextToken(value, ':');
+                if (key == "platform") {
+                    if (!kPlatformName.empty() && value != kPlatformName) {
+                        return false;
+                    }
+                    continue;
+                }
+                // output half axes ("+leftx") only show up for exotic devices and are not supported
+                for (const NamedOutput& output : kOutputs) {
+                    if (output.name != key) {
+                        continue;
+                    }
+                    GamepadMapping::Source source = {};
+                    if (ParseSource(value, source)) {
+                        (output.bAxis ? outMapping.axes[output.index] : outMapping.buttons[output.index]) = source;
+                    }
+                    break;
+                }
+            }
+            outGuidHash = HashGuid(guid);
+            return true;
+        }
+        u64 GamepadMappingDatabase::HashGuid(eastl::string_view guid) {
+            u64 hash = 14695981039346656037ull;
+            for (char c : guid) {
+                const char lower = c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+                hash = (hash ^ static_cast<u8>(lower)) * 1099511628211ull;
+            }
+            return hash;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
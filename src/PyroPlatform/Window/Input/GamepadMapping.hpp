@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/array.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/string_view.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/Input/Types.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        struct GamepadDeviceState;
+
+        // Where each standard button and axis of a pad is read from on the raw device
+        struct GamepadMapping {
+            struct Source {
+                enum struct Type : u8 {
+                    None,
+                    Button,
+                    Axis,
+                    Hat
+                };
+
+                Type type = Type::None;
+                u8 index = 0;
+                // hat direction bits for Hat sources
+                u8 hatMask = 0;
+                // Axis sources only: +1/-1 reads only that half of the axis, 0 the full range
+                i8 half = 0;
+                bool bInvert = false;
+            };
+
+            PYRO_NODISCARD bool ReadButton(GamepadButton button, const GamepadDeviceState& device) const;
+            // sticks are -1..1, triggers 0..1
+            PYRO_NODISCARD f32 ReadAxis(GamepadAxis axis, const GamepadDeviceState& device) const;
+
+            // Reads the arrays as they are, hat 0 as the dpad. Real devices report their own order,
+            // this is only right for sources that already follow GamepadLayout::Default.
+            static GamepadMapping Default();
+            // Reads the arrays as they are, dpad included, for GamepadLayout::Standard
+            static GamepadMapping Standard();
+
+            eastl::array<Source, static_cast<usize>(GamepadButton::COUNT)> buttons = {};
+            eastl::array<Source, static_cast<usize>(GamepadAxis::COUNT)> axes = {};
+        };
+
+        // SDL game controller mappings, parsed once and kept in a hash table keyed by device GUID
+        class GamepadMappingDatabase {
+        public:
+            // One mapping per line, blank lines and # comments are skipped, as are lines for other platforms.
+            // Returns the number of mappings added, a later mapping for the same GUID replaces the earlier one.
+            u32 AddMappings(eastl::string_view mappings);
+            PYRO_NODISCARD const GamepadMapping* Find(eastl::string_view guid) const;
+            PYRO_NODISCARD usize Size() const {
+                return mMappings.size();
+            }
+
+            static bool ParseMapping(eastl::string_view line, u64& outGuidHash, GamepadMapping& outMapping);
+            // case insensitive FNV-1a of the GUID
+            static u64 HashGuid(eastl::string_view guid);
+
+        private:
+            eastl::hash_map<u64, GamepadMapping> mMappings;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
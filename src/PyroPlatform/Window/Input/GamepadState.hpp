@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/array.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/Input/Types.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Polled state of every gamepad slot, laid out as structure of arrays: each axis is a
+        // contiguous run of f32 over all pads so deadzones and curves process every pad at once,
+        // and each pad's buttons are a bitset indexed by GamepadButton.
+        struct GamepadState {
+            static constexpr u32 kMaxGamepads = 16;
+            static constexpr u32 kAxisCount = static_cast<u32>(GamepadAxis::COUNT);
+            static constexpr u32 kButtonCount = static_cast<u32>(GamepadButton::COUNT);
+
+            PYRO_NODISCARD bool IsConnected(u32 pad) const {
+                return pad < kMaxGamepads && (connectedMask & (1u << pad)) != 0;
+            }
+            PYRO_NODISCARD f32 GetAxis(u32 pad, GamepadAxis axis) const {
+                return pad < kMaxGamepads ? axes[static_cast<u32>(axis)][pad] : 0.0f;
+            }
+            PYRO_NODISCARD bool IsButtonDown(u32 pad, GamepadButton button) const {
+                return pad < kMaxGamepads && (buttons[pad] & Bit(button)) != 0;
+            }
+            PYRO_NODISCARD bool WasPressed(u32 pad, GamepadButton button) const {
+                return pad < kMaxGamepads && (buttons[pad] & ~previousButtons[pad] & Bit(button)) != 0;
+            }
+            PYRO_NODISCARD bool WasReleased(u32 pad, GamepadButton button) const {
+                return pad < kMaxGamepads && (~buttons[pad] & previousButtons[pad] & Bit(button)) != 0;
+            }
+
+            static constexpr u32 Bit(GamepadButton button) {
+                return 1u << static_cast<u32>(button);
+            }
+
+            // axes[axis][pad]
+            alignas(64) f32 axes[kAxisCount][kMaxGamepads] = {};
+            eastl::array<u32, kMaxGamepads> buttons = {};
+            // buttons as of the previous poll, for edge queries
+            eastl::array<u32, kMaxGamepads> previousButtons = {};
+            u32 connectedMask = 0;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -21,11 +21,14 @@
 // SOFTWARE.
 
 #pragma once
+#include <EASTL/algorithm.h>
 #include <EASTL/string.h>
+#include <EASTL/string_view.h>
 #include <PyroCommon/Core.hpp>
 #include <PyroPlatform/Core.hpp>
 #include <PyroPlatform/Forward.hpp>
 #include <PyroPlatform/Window/Input/Types.hpp>
+#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
@@ -41,6 +44,13 @@ namespace PyroshockStudios {
             WindowFocus,
             WindowPosition,
             WindowResize,
+            TextInput,
+            WindowFramebufferResize,
+            WindowContentScale,
+            WindowIconify,
+            WindowMaximize,
+            WindowExpose,
+            WindowVisibility,
             COUNT
         };
 
@@ -48,25 +58,66 @@ namespace PyroshockStudios {
         class InputEvent : DeleteCopy {
         public:
             static constexpr InputEventType Type = E;
+            // large enough for the FormatTo output of any event but a long TextInputEvent
+            static constexpr usize kFormatBufferSize = 128;
 
             InputEvent(IWindow& sender)
                 : mWindow(sender) {}
             virtual ~InputEvent() = default;
 
             virtual InputEventType GetType() const = 0;
-            virtual eastl::string GetName() const = 0;
-            virtual eastl::string ToString() const = 0;
+            virtual eastl::string_view GetName() const = 0;
+            // Writes a readable description of the event into buffer without allocating.
+            // The output is truncated to fit and always null terminated, returns the number of characters written.
+            virtual usize FormatTo(char* buffer, usize capacity) const = 0;
+            // convenience only, allocates. Prefer FormatTo on hot paths (logging, overlays)
+            virtual eastl::string ToString() const {
+                eastl::string text(kFormatBufferSize - 1, '\0');
+                // a FormatTo that filled the whole string may have been cut short, grow until it fits
+                for (;;) {
+                    const usize length = FormatTo(text.data(), text.size() + 1);
+                    if (length < text.size()) {
+                        text.resize(length);
+                        return text;
+                    }
+                    text.resize(text.size() * 2);
+                }
+            }
 
             IWindow* Sender() {
                 return &mWindow;
             }
+            // IClock tick at which the backend received the event, 0 if unknown
+            u64 GetTimestamp() const {
+                return mTimestamp;
+            }
 
             bool WasHandled() const {
                 return bHandled;
             }
+            // stops the event from reaching any lower priority handlers
+            void SetHandled() {
+                bHandled = true;
+            }
 
         protected:
+            template <typename... Args>
+            static usize Format(char* buffer, usize capacity, const char* format, Args... args) {
+                if (capacity == 0) {
+                    return 0;
+                }
+                const int length = snprintf(buffer, capacity, format, args...);
+                if (length < 0) {
+                    buffer[0] = '\0';
+                    return 0;
+                }
+                return eastl::min(static_cast<usize>(length), capacity - 1);
+            }
+
+            friend class WindowEvents;
+
             bool bHandled = false;
+            u64 mTimestamp = 0;
             IWindow& mWindow;
         };
     } // namespace Platform
@@ -22,94 +22,349 @@
 
 #pragma once
 #include "InputEvent.hpp"
+#include "InputInstrumentation.hpp"
+#include "LatencyHistogram.hpp"
 
 #include <PyroCommon/Types.hpp>
 
+#include <EASTL/algorithm.h>
+#include <EASTL/fixed_function.h>
 #include <EASTL/functional.h>
 #include <EASTL/vector.h>
-#include <PyroCommon/GUID.hpp>
 #include <cassert>
 
 namespace PyroshockStudios {
     inline namespace Platform {
+        // Handler captures are stored inline, a lambda capturing more than this fails to compile instead of allocating
+        static constexpr usize kInputEventHandlerCaptureSize = 4 * sizeof(void*);
+
+        template <typename Event>
+        using DispatchableEvent = eastl::fixed_function<kInputEventHandlerCaptureSize, void(Event&)>;
+
         template <typename Event>
-        using DispatchableEvent = eastl::function<void(Event&)>;
+        class InputEventDispatcher;
 
+        // Generational handle to a bound handler. The low bits index the dispatcher slot,
+        // the high bits hold the slot generation so stale handles are rejected after reuse.
         template <typename Event>
-        class InputEventHandler {
+        class InputEventHandle {
         public:
-            InputEventHandler() = default;
+            static constexpr u32 kIndexBits = 20;
+            static constexpr u32 kIndexMask = (1u << kIndexBits) - 1;
+            static constexpr u32 kGenerationMask = (1u << (32 - kIndexBits)) - 1;
 
-            InputEventHandler(const DispatchableEvent<Event>& fn) noexcept : mFn(fn), kHandle(GUID()) {}
+            InputEventHandle() = default;
 
-            InputEventHandler(const InputEventHandler& other) : mFn(other.mFn), kHandle(other.kHandle) {}
-            InputEventHandler& operator=(const InputEventHandler& other) noexcept {
-                if (*this == other)
-                    return *this;
-                mFn = other.mFn;
-                const_cast<GUID&>(kHandle) = other.kHandle;
-                return *this;
+            PYRO_NODISCARD bool Valid() const {
+                return mValue != 0;
             }
-            InputEventHandler(InputEventHandler&& other) noexcept : mFn(eastl::move(other.mFn)), kHandle(other.kHandle) {
-                other.mFn = {};
-                const_cast<GUID&>(other.kHandle) = GUID::Invalid();
+            PYRO_NODISCARD u32 GetIndex() const {
+                return mValue & kIndexMask;
             }
-            InputEventHandler& operator=(InputEventHandler&& other) noexcept {
-                if (*this == other)
-                    return *this;
-                mFn = eastl::move(other.mFn);
-                other.mFn = {};
-                const_cast<GUID&>(kHandle) = other.kHandle;
-                const_cast<GUID&>(other.kHandle) = GUID::Invalid();
-                return *this;
+            PYRO_NODISCARD u32 GetGeneration() const {
+                return mValue >> kIndexBits;
             }
-
-            bool operator==(const InputEventHandler& other) const noexcept {
-                return this->kHandle == other.kHandle;
+            bool operator==(const InputEventHandle& other) const {
+                return mValue == other.mValue;
             }
 
-            void operator()(Event& e) {
-                mFn(e);
-            }
-
-            const GUID kHandle = GUID::Invalid();
-
         private:
-            DispatchableEvent<Event> mFn;
+            friend class InputEventDispatcher<Event>;
+            InputEventHandle(u32 index, u32 generation) : mValue((generation << kIndexBits) | index) {}
+
+            // generation 0 is never handed out, so a zero value is the invalid handle
+            u32 mValue = 0;
         };
 
+        // Handlers are kept in dense arrays sorted by priority (highest first, then bind order)
+        // and iterated contiguously. The order is fixed up at bind time so Dispatch never sorts;
+        // binding at or below the lowest priority is a plain append. A handler calling
+        // SetHandled() on the event stops the dispatch.
+        // Unbinding only marks the dense entry dead; dead entries are compacted away
+        // once they make up half of the array, keeping unbind O(1) amortised.
+        //
+        // Handlers may bind, unbind (including themselves) and dispatch again from inside
+        // Dispatch. The dense arrays are never restructured while a dispatch is running:
+        // an unbind takes effect immediately through the slot generation, while binds are
+        // queued and become visible once the outermost dispatch returns.
+        //
+        // Built with PYRO_PLATFORM_INPUT_INSTRUMENTATION, dispatches are timed while gInputInstrumentation
+        // has a clock: dispatch count and total time per dispatcher, and a time histogram per handler.
+        // Without it none of this exists and the bind site argument is an empty struct.
         template <typename Event>
         class InputEventDispatcher {
         public:
+            using Handle = InputEventHandle<Event>;
+
             InputEventDispatcher() = default;
 
             void Dispatch(Event& e) {
-                for (InputEventHandler<Event>& fn : functions) {
-                    assert(fn.kHandle.Valid());
-                    fn(e);
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+                if (IClock* clock = gInputInstrumentation.GetClock()) {
+                    DispatchInstrumented(e, *clock);
+                    return;
+                }
+#endif
+                ++mDispatchDepth;
+                const usize count = mCallbacks.size();
+                for (usize i = 0; i < count; ++i) {
+                    if (mOwners[i] != kDeadEntry) {
+                        mCallbacks[i](e);
+                        if (WasHandled(e)) {
+                            break;
+                        }
+                    }
+                }
+                if (--mDispatchDepth == 0) {
+                    ApplyDeferred();
+                }
+            }
+
+            // higher priority handlers run first
+            PYRO_NODISCARD Handle Bind(DispatchableEvent<Event>&& fn, i32 priority = 0, InputBindSite site = InputBindSite::current()) {
+                u32 index = mFreeSlot;
+                if (index != kNoSlot) {
+                    mFreeSlot = mSlots[index].denseIndex;
+                } else {
+                    index = static_cast<u32>(mSlots.size());
+                    assert(index <= Handle::kIndexMask && "Too many handlers bound to a single dispatcher!");
+                    mSlots.push_back({ kNoSlot, 1 });
+                }
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+                if (index >= mHandlerStats.size()) {
+                    mHandlerStats.resize(index + 1);
+                }
+                mHandlerStats[index] = { site };
+#endif
+                Slot& slot = mSlots[index];
+                const u32 generation = slot.generation;
+                if (mDispatchDepth > 0) {
+                    slot.denseIndex = kPendingEntry;
+                    mPending.push_back({ eastl::move(fn), index, priority });
+                } else {
+                    Insert(eastl::move(fn), index, priority);
                 }
+                return Handle(index, generation);
             }
-            bool Bind(const InputEventHandler<Event>& handler) {
-                assert(handler.kHandle.Valid());
-                if (eastl::find(functions.begin(), functions.end(), handler) != functions.end()) {
+            bool Unbind(Handle handle) {
+                if (!IsBound(handle)) {
                     return false;
                 }
-                functions.emplace_back(handler);
+                const u32 index = handle.GetIndex();
+                Slot& slot = mSlots[index];
+                if (slot.denseIndex == kPendingEntry) {
+                    for (PendingBind& pending : mPending) {
+                        if (pending.slot == index) {
+                            pending.slot = kDeadEntry;
+                            break;
+                        }
+                    }
+                } else {
+                    // the callable is only destroyed on compaction, it may be the one running right now
+                    mOwners[slot.denseIndex] = kDeadEntry;
+                    ++mDeadCount;
+                }
+
+                slot.generation = (slot.generation + 1) & Handle::kGenerationMask;
+                if (slot.generation == 0) {
+                    slot.generation = 1;
+                }
+                slot.denseIndex = mFreeSlot;
+                mFreeSlot = index;
+
+                if (mDispatchDepth == 0 && mDeadCount * 2 > mCallbacks.size()) {
+                    Compact();
+                }
                 return true;
             }
-            bool Unbind(const InputEventHandler<Event>& handler) {
-                assert(handler.kHandle.Valid());
-                for (i32 i = 0; i < functions.size(); ++i) {
-                    if (functions[i] == handler) {
-                        functions.erase(functions.begin() + i);
-                        return true;
+            // a slot's generation moves on as soon as it is unbound, so a matching generation means bound
+            PYRO_NODISCARD bool IsBound(Handle handle) const {
+                if (!handle.Valid() || handle.GetIndex() >= mSlots.size()) {
+                    return false;
+                }
+                return mSlots[handle.GetIndex()].generation == handle.GetGeneration();
+            }
+            // includes binds still waiting for the running dispatch to finish
+            PYRO_NODISCARD usize Size() const {
+                usize pending = 0;
+                for (const PendingBind& bind : mPending) {
+                    pending += bind.slot != kDeadEntry ? 1 : 0;
+                }
+                return mCallbacks.size() - mDeadCount + pending;
+            }
+            PYRO_NODISCARD bool IsDispatching() const {
+                return mDispatchDepth > 0;
+            }
+
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+            struct HandlerStats {
+                InputBindSite site = {};
+                LatencyHistogram time = {};
+                u64 overBudgetCount = 0;
+            };
+
+            PYRO_NODISCARD u64 GetDispatchCount() const {
+                return mDispatchCount;
+            }
+            PYRO_NODISCARD u64 GetDispatchNanoseconds() const {
+                return mDispatchNanoseconds;
+            }
+            // null for handles that are no longer bound
+            PYRO_NODISCARD const HandlerStats* GetHandlerStats(Handle handle) const {
+                return IsBound(handle) ? &mHandlerStats[handle.GetIndex()] : nullptr;
+            }
+            // Calls fn(const HandlerStats&) for every bound handler, in dispatch order
+            template <typename Fn>
+            void ForEachHandlerStats(Fn&& fn) const {
+                for (u32 owner : mOwners) {
+                    if (owner != kDeadEntry) {
+                        fn(mHandlerStats[owner]);
                     }
                 }
-                return false;
             }
+            void ResetStats() {
+                mDispatchCount = 0;
+                mDispatchNanoseconds = 0;
+                for (HandlerStats& stats : mHandlerStats) {
+                    stats.time.Reset();
+                    stats.overBudgetCount = 0;
+                }
+            }
+#endif
 
         private:
-            eastl::vector<InputEventHandler<Event>> functions;
+            static constexpr u32 kNoSlot = ~0u;
+            static constexpr u32 kDeadEntry = ~0u;
+            static constexpr u32 kPendingEntry = ~0u - 1;
+
+            struct Slot {
+                // dense position while bound, next free slot while unbound
+                u32 denseIndex;
+                u32 generation;
+            };
+
+            struct PendingBind {
+                DispatchableEvent<Event> fn;
+                u32 slot;
+                i32 priority;
+            };
+
+            static bool WasHandled(const Event& e) {
+                if constexpr (requires { e.WasHandled(); }) {
+                    return e.WasHandled();
+                } else {
+                    return false;
+                }
+            }
+
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+            static constexpr eastl::string_view GetEventName() {
+                if constexpr (requires { Event::kName; }) {
+                    return Event::kName;
+                } else {
+                    return {};
+                }
+            }
+
+            // Same walk as Dispatch with every handler timed
+            void DispatchInstrumented(Event& e, IClock& clock) {
+                ++mDispatchDepth;
+                const u64 start = clock.GetTicks();
+                u64 handlerStart = start;
+                const usize count = mCallbacks.size();
+                for (usize i = 0; i < count; ++i) {
+                    const u32 owner = mOwners[i];
+                    if (owner == kDeadEntry) {
+                        continue;
+                    }
+                    mCallbacks[i](e);
+                    const u64 handlerEnd = clock.GetTicks();
+                    // the handler may have unbound itself, its stats slot stays valid until it is reused
+                    HandlerStats& stats = mHandlerStats[owner];
+                    const u64 nanoseconds = gInputInstrumentation.ToNanoseconds(handlerEnd - handlerStart);
+                    stats.time.Record(nanoseconds);
+                    if (gInputInstrumentation.CheckBudget(GetEventName(), stats.site, nanoseconds)) {
+                        ++stats.overBudgetCount;
+                    }
+                    handlerStart = handlerEnd;
+                    if (WasHandled(e)) {
+                        break;
+                    }
+                }
+                ++mDispatchCount;
+                mDispatchNanoseconds += gInputInstrumentation.ToNanoseconds(handlerStart - start);
+                if (--mDispatchDepth == 0) {
+                    ApplyDeferred();
+                }
+            }
+#endif
+
+            void Insert(DispatchableEvent<Event>&& fn, u32 slot, i32 priority) {
+                usize position = mPriorities.size();
+                if (!mPriorities.empty() && priority > mPriorities.back()) {
+                    // first entry with a strictly lower priority, equal priorities keep bind order
+                    position = eastl::upper_bound(mPriorities.begin(), mPriorities.end(), priority, eastl::greater<i32>()) - mPriorities.begin();
+                }
+                mCallbacks.insert(mCallbacks.begin() + position, eastl::move(fn));
+                mOwners.insert(mOwners.begin() + position, slot);
+                mPriorities.insert(mPriorities.begin() + position, priority);
+                for (usize i = position; i < mOwners.size(); ++i) {
+                    if (mOwners[i] != kDeadEntry) {
+                        mSlots[mOwners[i]].denseIndex = static_cast<u32>(i);
+                    }
+                }
+            }
+
+            void ApplyDeferred() {
+                if (!mPending.empty()) {
+                    // a pending handler may have been unbound again before the dispatch ended
+                    for (PendingBind& pending : mPending) {
+                        if (pending.slot == kDeadEntry) {
+                            continue;
+                        }
+                        Insert(eastl::move(pending.fn), pending.slot, pending.priority);
+                    }
+                    mPending.clear();
+                }
+                if (mDeadCount * 2 > mCallbacks.size()) {
+                    Compact();
+                }
+            }
+
+            void Compact() {
+                usize write = 0;
+                for (usize read = 0; read < mCallbacks.size(); ++read) {
+                    if (mOwners[read] == kDeadEntry) {
+                        continue;
+                    }
+                    if (write != read) {
+                        mCallbacks[write] = eastl::move(mCallbacks[read]);
+                        mOwners[write] = mOwners[read];
+                        mPriorities[write] = mPriorities[read];
+                    }
+                    mSlots[mOwners[write]].denseIndex = static_cast<u32>(write);
+                    ++write;
+                }
+                mCallbacks.resize(write);
+                mOwners.resize(write);
+                mPriorities.resize(write);
+                mDeadCount = 0;
+            }
+
+            eastl::vector<DispatchableEvent<Event>> mCallbacks;
+            eastl::vector<u32> mOwners;
+            eastl::vector<i32> mPriorities;
+            eastl::vector<Slot> mSlots;
+            eastl::vector<PendingBind> mPending;
+            u32 mFreeSlot = kNoSlot;
+            u32 mDeadCount = 0;
+            u32 mDispatchDepth = 0;
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+            // indexed by slot, so they stay put while the dense arrays are reordered
+            eastl::vector<HandlerStats> mHandlerStats;
+            u64 mDispatchCount = 0;
+            u64 mDispatchNanoseconds = 0;
+#endif
         };
     } // namespace Platform
-} // namespace PyroshockStudios
\ No newline at end of file
+} // namespace PyroshockStudios
@@ -0,0 +1,187 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEventRecord.hpp"
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+#include <cassert>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Ring buffer of input records. Storage is allocated up front; if a frame
+        // produces more events than the capacity, the buffer doubles instead of dropping
+        // input (a dropped key release would leave the key stuck) and the overflow is counted.
+        //
+        // Cursor motion, scroll, window position and resize can opt into coalescing: a pushed record
+        // is folded into the latest queued record of the same type, as long as only other coalescing
+        // records were queued after it. Key, button and every other record act as a barrier,
+        // so their order relative to everything else is kept.
+        class InputEventQueue {
+        public:
+            static constexpr u32 kDefaultCapacity = 1024;
+
+            InputEventQueue(u32 capacity = kDefaultCapacity) {
+                Reserve(capacity);
+            }
+
+            void Push(const InputEventRecord& record) {
+                if (IsCoalescing(record.type) && TryMerge(record)) {
+                    return;
+                }
+                if (Size() == static_cast<u32>(mRecords.size())) {
+                    ++mOverflowCount;
+                    Reserve(static_cast<u32>(mRecords.size()) * 2);
+                }
+                mRecords[mTail & mMask] = record;
+                ++mTail;
+            }
+            PYRO_NODISCARD const InputEventRecord& Front() const {
+                return mRecords[mHead & mMask];
+            }
+            void Pop() {
+                ++mHead;
+            }
+            void Clear() {
+                mHead = 0;
+                mTail = 0;
+            }
+
+            PYRO_NODISCARD bool Empty() const {
+                return mHead == mTail;
+            }
+            PYRO_NODISCARD u32 Size() const {
+                return mTail - mHead;
+            }
+            PYRO_NODISCARD u32 Capacity() const {
+                return static_cast<u32>(mRecords.size());
+            }
+            // how many times the queue had to grow past its capacity
+            PYRO_NODISCARD u32 GetOverflowCount() const {
+                return mOverflowCount;
+            }
+
+            PYRO_NODISCARD static constexpr bool IsCoalescable(InputEventType type) {
+                return type == InputEventType::CursorPosition || type == InputEventType::CursorScroll ||
+                       type == InputEventType::WindowPosition || type == InputEventType::WindowResize ||
+                       type == InputEventType::WindowFramebufferResize || type == InputEventType::WindowContentScale;
+            }
+            void SetCoalescing(InputEventType type, bool bEnabled) {
+                assert(IsCoalescable(type) && "Event type has no coalescing policy!");
+                if (!IsCoalescable(type)) {
+                    return;
+                }
+                const u32 bit = 1u << static_cast<u32>(type);
+                mCoalesceMask = bEnabled ? (mCoalesceMask | bit) : (mCoalesceMask & ~bit);
+            }
+            PYRO_NODISCARD bool IsCoalescing(InputEventType type) const {
+                return type > InputEventType::Unknown && type < InputEventType::COUNT &&
+                       (mCoalesceMask & (1u << static_cast<u32>(type))) != 0;
+            }
+            // how many pushed records of the type were folded into an already queued one
+            PYRO_NODISCARD u64 GetMergedCount(InputEventType type) const {
+                return mMergedCounts[static_cast<usize>(type)];
+            }
+            PYRO_NODISCARD u64 GetMergedCount() const {
+                u64 total = 0;
+                for (u64 count : mMergedCounts) {
+                    total += count;
+                }
+                return total;
+            }
+            void ResetMergedCounts() {
+                mMergedCounts.fill(0);
+            }
+
+            // capacity is rounded up to a power of two
+            void Reserve(u32 capacity) {
+                u32 newCapacity = 1;
+                while (newCapacity < capacity) {
+                    newCapacity <<= 1;
+                }
+                if (newCapacity <= mRecords.size()) {
+                    return;
+                }
+                eastl::vector<InputEventRecord> records(newCapacity);
+                const u32 count = Size();
+                for (u32 i = 0; i < count; ++i) {
+                    records[i] = mRecords[(mHead + i) & mMask];
+                }
+                mRecords = eastl::move(records);
+                mMask = newCapacity - 1;
+                mHead = 0;
+                mTail = count;
+            }
+
+        private:
+            bool TryMerge(const InputEventRecord& record) {
+                // the trailing run of coalescing records holds at most one record per type
+                for (u32 i = mTail; i != mHead; --i) {
+                    InputEventRecord& queued = mRecords[(i - 1) & mMask];
+                    if (!IsCoalescing(queued.type)) {
+                        return false;
+                    }
+                    if (queued.type == record.type) {
+                        Merge(queued, record);
+                        ++mMergedCounts[static_cast<usize>(record.type)];
+                        return true;
+                    }
+                }
+                return false;
+            }
+            // the queued record keeps its sequence, it still sits at that spot in the stream
+            static void Merge(InputEventRecord& queued, const InputEventRecord& record) {
+                switch (record.type) {
+                case InputEventType::CursorPosition:
+                    queued.motion.x = record.motion.x;
+                    queued.motion.y = record.motion.y;
+                    queued.motion.deltaX += record.motion.deltaX;
+                    queued.motion.deltaY += record.motion.deltaY;
+                    break;
+                case InputEventType::CursorScroll:
+                    queued.vector.x += record.vector.x;
+                    queued.vector.y += record.vector.y;
+                    break;
+                case InputEventType::WindowPosition:
+                case InputEventType::WindowContentScale:
+                    queued.vector = record.vector;
+                    break;
+                case InputEventType::WindowResize:
+                case InputEventType::WindowFramebufferResize:
+                    queued.size = record.size;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            eastl::vector<InputEventRecord> mRecords;
+            u32 mMask = 0;
+            u32 mHead = 0;
+            u32 mTail = 0;
+            u32 mOverflowCount = 0;
+            u32 mCoalesceMask = 0;
+            eastl::array<u64, static_cast<usize>(InputEventType::COUNT)> mMergedCounts = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
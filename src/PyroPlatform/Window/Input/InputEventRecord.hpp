@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEvent.hpp"
+
+#include <PyroPlatform/Window/IWindow.hpp>
+
+#include <EASTL/type_traits.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Compact POD form of every window event. Window callbacks fill these in and
+        // WindowEvents turns them back into the proper event type when dispatching.
+        struct InputEventRecord {
+            struct KeyData {
+                KeyCode key;
+                i32 scanCode;
+                InputModifiers::Flags modifiers;
+                bool bDown;
+                bool bRepeating;
+            };
+            struct MouseData {
+                MouseButton button;
+                InputModifiers::Flags modifiers;
+                bool bDown;
+            };
+            struct VectorData {
+                f64 x;
+                f64 y;
+            };
+            struct MotionData {
+                f64 x;
+                f64 y;
+                // movement since the previous position, accumulates when motion is coalesced
+                f64 deltaX;
+                f64 deltaY;
+            };
+            struct SizeData {
+                u32 width;
+                u32 height;
+            };
+            struct ToggleData {
+                bool bValue;
+            };
+            struct CharData {
+                u32 unicode;
+            };
+            struct RectData {
+                i32 x;
+                i32 y;
+                u32 width;
+                u32 height;
+                // rectangles still to come in the same series, the event goes out with the last one
+                u32 remaining;
+            };
+            struct VisibilityData {
+                WindowVisibilityState state;
+            };
+
+            InputEventType type = InputEventType::Unknown;
+            // global arrival order, used to interleave events from several windows
+            u64 sequence = 0;
+            // IClock tick taken when the backend received the event, or mapped from the display server's
+            // own event time where it reports one (XCB), 0 when no clock is available
+            u64 timestamp = 0;
+            union {
+                KeyData key;
+                MouseData mouse;
+                VectorData vector;
+                MotionData motion;
+                SizeData size;
+                ToggleData toggle;
+                CharData character;
+                RectData rect;
+                VisibilityData visibility;
+            };
+
+            static InputEventRecord Key(KeyCode key, i32 scanCode, InputModifiers::Flags mods, bool bDown, bool bRepeating) {
+                InputEventRecord record = Make(InputEventType::Key);
+                record.key = { key, scanCode, mods, bDown, bRepeating };
+                return record;
+            }
+            static InputEventRecord Mouse(MouseButton button, InputModifiers::Flags mods, bool bDown) {
+                InputEventRecord record = Make(InputEventType::Mouse);
+                record.mouse = { button, mods, bDown };
+                return record;
+            }
+            static InputEventRecord CursorScroll(f64 x, f64 y) {
+                InputEventRecord record = Make(InputEventType::CursorScroll);
+                record.vector = { x, y };
+                return record;
+            }
+            static InputEventRecord CursorPosition(f64 x, f64 y, f64 deltaX = 0.0, f64 deltaY = 0.0) {
+                InputEventRecord record = Make(InputEventType::CursorPosition);
+                record.motion = { x, y, deltaX, deltaY };
+                return record;
+            }
+            static InputEventRecord CursorEnter(bool bEntered) {
+                InputEventRecord record = Make(InputEventType::CursorEnter);
+                record.toggle = { bEntered };
+                return record;
+            }
+            static InputEventRecord CharInput(u32 unicode) {
+                InputEventRecord record = Make(InputEventType::CharInput);
+                record.character = { unicode };
+                return record;
+            }
+            static InputEventRecord WindowClose() {
+                return Make(InputEventType::WindowClose);
+            }
+            static InputEventRecord WindowFocus(bool bFocused) {
+                InputEventRecord record = Make(InputEventType::WindowFocus);
+                record.toggle = { bFocused };
+                return record;
+            }
+            static InputEventRecord WindowPosition(f64 x, f64 y) {
+                InputEventRecord record = Make(InputEventType::WindowPosition);
+                record.vector = { x, y };
+                return record;
+            }
+            static InputEventRecord WindowResize(u32 width, u32 height) {
+                InputEventRecord record = Make(InputEventType::WindowResize);
+                record.size = { width, height };
+                return record;
+            }
+            static InputEventRecord WindowFramebufferResize(u32 width, u32 height) {
+                InputEventRecord record = Make(InputEventType::WindowFramebufferResize);
+                record.size = { width, height };
+                return record;
+            }
+            static InputEventRecord WindowContentScale(f64 x, f64 y) {
+                InputEventRecord record = Make(InputEventType::WindowContentScale);
+                record.vector = { x, y };
+                return record;
+            }
+            static InputEventRecord WindowIconify(bool bIconified) {
+                InputEventRecord record = Make(InputEventType::WindowIconify);
+                record.toggle = { bIconified };
+                return record;
+            }
+            static InputEventRecord WindowMaximize(bool bMaximized) {
+                InputEventRecord record = Make(InputEventType::WindowMaximize);
+                record.toggle = { bMaximized };
+                return record;
+            }
+
+            static InputEventRecord WindowExpose(i32 x, i32 y, u32 width, u32 height, u32 remaining = 0) {
+                InputEventRecord record = Make(InputEventType::WindowExpose);
+                record.rect = { x, y, width, height, remaining };
+                return record;
+            }
+            static InputEventRecord WindowVisibility(WindowVisibilityState state) {
+                InputEventRecord record = Make(InputEventType::WindowVisibility);
+                record.visibility = { state };
+                return record;
+            }
+
+        private:
+            static InputEventRecord Make(InputEventType type) {
+                InputEventRecord record = {};
+                record.type = type;
+                record.motion = { 0.0, 0.0, 0.0, 0.0 };
+                return record;
+            }
+        };
+        static_assert(eastl::is_trivially_copyable<InputEventRecord>::value, "InputEventRecord must stay POD");
+    } // namespace Platform
+} // namespace PyroshockStudios
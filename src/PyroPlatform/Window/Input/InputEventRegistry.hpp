@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEventDispatcher.hpp"
+
+#include <PyroCommon/Types.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        template <typename Event>
+        struct InputEventSlot {
+            InputEventDispatcher<Event> dispatcher = {};
+        };
+
+        // One dispatcher per event type in the list, each stored in its own correctly sized slot.
+        // Lookup is resolved at compile time through the slot base class, there is no runtime check.
+        template <typename... Events>
+        class InputEventRegistry : private InputEventSlot<Events>... {
+        public:
+            template <typename Event>
+            static constexpr bool kContains = (eastl::is_same_v<Event, Events> || ...);
+
+            template <typename Event>
+            PYRO_NODISCARD InputEventDispatcher<Event>& Get() {
+                static_assert(kContains<Event>, "Event is not part of this registry!");
+                return static_cast<InputEventSlot<Event>&>(*this).dispatcher;
+            }
+            template <typename Event>
+            PYRO_NODISCARD const InputEventDispatcher<Event>& Get() const {
+                static_assert(kContains<Event>, "Event is not part of this registry!");
+                return static_cast<const InputEventSlot<Event>&>(*this).dispatcher;
+            }
+        };
+
+        // Process wide index for event types that are not known at compile time, assigned on first use
+        inline u32 NextCustomInputEventId() {
+            static eastl::atomic<u32> next = 0;
+            return next.fetch_add(1, eastl::memory_order_relaxed);
+        }
+        template <typename Event>
+        u32 CustomInputEventId() {
+            static const u32 id = NextCustomInputEventId();
+            return id;
+        }
+
+        // Dispatchers for application defined events. Slots are allocated the first time a type is used,
+        // Register() can be called up front to keep that allocation out of the hot path.
+        class CustomInputEventRegistry {
+        public:
+            template <typename Event>
+            void Register() {
+                (void)Get<Event>();
+            }
+            template <typename Event>
+            PYRO_NODISCARD InputEventDispatcher<Event>& Get() {
+                const u32 id = CustomInputEventId<Event>();
+                if (id >= mSlots.size()) {
+                    mSlots.resize(id + 1);
+                }
+                if (!mSlots[id]) {
+                    mSlots[id] = eastl::make_unique<Slot<Event>>();
+                }
+                return static_cast<Slot<Event>*>(mSlots[id].get())->dispatcher;
+            }
+
+        private:
+            struct ISlot {
+                virtual ~ISlot() = default;
+            };
+            template <typename Event>
+            struct Slot final : ISlot {
+                InputEventDispatcher<Event> dispatcher = {};
+            };
+
+            eastl::vector<eastl::unique_ptr<ISlot>> mSlots = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEventRecord.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/atomic.h>
+#include <EASTL/bit.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        struct IWindow;
+
+        // Lock-free single producer, single consumer ring of records along with the window they came from.
+        // A full ring drops the record instead of stalling the producer, GetDroppedCount() reports how many.
+        // Only records whose type was marked wanted are meant to be pushed, see IsWanted().
+        class InputEventRing : DeleteCopy, DeleteMove {
+        public:
+            struct Entry {
+                IWindow* window;
+                InputEventRecord record;
+            };
+
+            InputEventRing(u32 capacity = 1024)
+                : mEntries(eastl::bit_ceil(eastl::max(capacity, 2u))), mMask(static_cast<u32>(mEntries.size()) - 1) {}
+
+            void Want(InputEventType type) {
+                mWantedTypes.fetch_or(TypeBit(type), eastl::memory_order_relaxed);
+            }
+            void Unwant(InputEventType type) {
+                mWantedTypes.fetch_and(~TypeBit(type), eastl::memory_order_relaxed);
+            }
+            PYRO_NODISCARD bool IsWanted(InputEventType type) const {
+                if (type <= InputEventType::Unknown || type >= InputEventType::COUNT) {
+                    return false;
+                }
+                return (mWantedTypes.load(eastl::memory_order_relaxed) & TypeBit(type)) != 0;
+            }
+
+            // producer side
+            bool Push(IWindow& window, const InputEventRecord& record) {
+                const u32 tail = mTail.load(eastl::memory_order_relaxed);
+                if (tail - mHead.load(eastl::memory_order_acquire) > mMask) {
+                    mDropped.fetch_add(1, eastl::memory_order_relaxed);
+                    return false;
+                }
+                mEntries[tail & mMask] = { &window, record };
+                mTail.store(tail + 1, eastl::memory_order_release);
+                return true;
+            }
+            // consumer side
+            bool Pop(Entry& out) {
+                const u32 head = mHead.load(eastl::memory_order_relaxed);
+                if (head == mTail.load(eastl::memory_order_acquire)) {
+                    return false;
+                }
+                out = mEntries[head & mMask];
+                mHead.store(head + 1, eastl::memory_order_release);
+                return true;
+            }
+
+            PYRO_NODISCARD usize GetPendingCount() const {
+                return mTail.load(eastl::memory_order_acquire) - mHead.load(eastl::memory_order_acquire);
+            }
+            PYRO_NODISCARD usize GetCapacity() const {
+                return mEntries.size();
+            }
+            PYRO_NODISCARD u64 GetDroppedCount() const {
+                return mDropped.load(eastl::memory_order_relaxed);
+            }
+
+        private:
+            static constexpr u32 TypeBit(InputEventType type) {
+                return 1u << static_cast<u32>(type);
+            }
+            static_assert(static_cast<u32>(InputEventType::COUNT) <= 32, "Wanted type mask is too small!");
+
+            eastl::vector<Entry> mEntries;
+            const u32 mMask;
+            eastl::atomic<u32> mWantedTypes = 0;
+            eastl::atomic<u64> mDropped = 0;
+            // producer and consumer indices on their own cache lines
+            alignas(64) eastl::atomic<u32> mHead = 0;
+            alignas(64) eastl::atomic<u32> mTail = 0;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,102 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/fixed_function.h>
+#include <EASTL/string_view.h>
+
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Time/IClock.hpp>
+
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+#include <source_location>
+#endif
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+        // Where a handler was bound, filled in by the default argument of Bind/BindEvent
+        using InputBindSite = std::source_location;
+
+        struct InputSlowHandler {
+            eastl::string_view eventName;
+            InputBindSite site;
+            u64 nanoseconds;
+        };
+        using InputSlowHandlerCallback = eastl::fixed_function<2 * sizeof(void*), void(const InputSlowHandler&)>;
+
+        // Process wide settings for dispatcher instrumentation. Dispatchers only measure while a clock
+        // is set. The slow handler callback runs on whichever thread dispatched the event.
+        class InputInstrumentation {
+        public:
+            void SetClock(IClock* clock) {
+                mTickFrequency = clock ? clock->GetTickFrequency() : 0;
+                mClock = clock;
+            }
+            PYRO_NODISCARD IClock* GetClock() const {
+                return mClock;
+            }
+            // A handler taking longer than budgetNanoseconds reports itself through the callback
+            void SetSlowHandlerBudget(u64 budgetNanoseconds, InputSlowHandlerCallback&& callback) {
+                mSlowHandlerBudget = budgetNanoseconds;
+                mSlowHandlerCallback = eastl::move(callback);
+            }
+            void ClearSlowHandlerBudget() {
+                mSlowHandlerBudget = 0;
+                mSlowHandlerCallback = {};
+            }
+
+            PYRO_NODISCARD u64 ToNanoseconds(u64 ticks) const {
+                if (mTickFrequency == 1000000000ull) {
+                    return ticks;
+                }
+                return static_cast<u64>(static_cast<f64>(ticks) * 1e9 / static_cast<f64>(mTickFrequency));
+            }
+            // returns true if the handler went over budget
+            bool CheckBudget(eastl::string_view eventName, const InputBindSite& site, u64 nanoseconds) const {
+                if (mSlowHandlerBudget == 0 || nanoseconds <= mSlowHandlerBudget) {
+                    return false;
+                }
+                if (mSlowHandlerCallback) {
+                    mSlowHandlerCallback({ eventName, site, nanoseconds });
+                }
+                return true;
+            }
+
+        private:
+            IClock* mClock = nullptr;
+            u64 mTickFrequency = 0;
+            u64 mSlowHandlerBudget = 0;
+            InputSlowHandlerCallback mSlowHandlerCallback = {};
+        };
+
+        inline InputInstrumentation gInputInstrumentation = {};
+#else
+        // Empty when instrumentation is compiled out, so the bind site costs nothing
+        struct InputBindSite {
+            static constexpr InputBindSite current() {
+                return {};
+            }
+        };
+#endif
+    } // namespace Platform
+} // namespace PyroshockStudios
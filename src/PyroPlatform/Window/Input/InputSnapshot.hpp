@@ -0,0 +1,178 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEventRecord.hpp"
+
+#include <EASTL/atomic.h>
+#include <EASTL/bitset.h>
+#include <EASTL/type_traits.h>
+#include <cstring>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Plain copy of a window's keyboard and mouse state for one frame. Trivially copyable
+        // so it can be handed to job threads by value.
+        // Edge bits accumulate for the whole frame, a key tapped and released within one frame
+        // reports both WasPressed and WasReleased while no longer being down.
+        struct InputSnapshot {
+            static constexpr usize kKeyCount = static_cast<usize>(KeyCode::Last) + 1;
+            static constexpr usize kMouseButtonCount = static_cast<usize>(MouseButton::Last) + 1;
+
+            PYRO_NODISCARD bool IsKeyDown(KeyCode key) const {
+                return Test(keysDown, key);
+            }
+            PYRO_NODISCARD bool WasPressed(KeyCode key) const {
+                return Test(keysPressed, key);
+            }
+            PYRO_NODISCARD bool WasReleased(KeyCode key) const {
+                return Test(keysReleased, key);
+            }
+            PYRO_NODISCARD bool IsMouseDown(MouseButton button) const {
+                return Test(mouseDown, button);
+            }
+            PYRO_NODISCARD bool WasPressed(MouseButton button) const {
+                return Test(mousePressed, button);
+            }
+            PYRO_NODISCARD bool WasReleased(MouseButton button) const {
+                return Test(mouseReleased, button);
+            }
+
+            // Folds a window event into the state, records other than key, mouse and cursor ones are ignored
+            void Apply(const InputEventRecord& record) {
+                switch (record.type) {
+                case InputEventType::Key:
+                    // repeats don't count as a new press
+                    if (!record.key.bRepeating) {
+                        Set(keysDown, keysPressed, keysReleased, record.key.key, record.key.bDown);
+                    }
+                    modifiers = record.key.modifiers;
+                    break;
+                case InputEventType::Mouse:
+                    Set(mouseDown, mousePressed, mouseReleased, record.mouse.button, record.mouse.bDown);
+                    modifiers = record.mouse.modifiers;
+                    break;
+                case InputEventType::CursorPosition:
+                    cursorX = record.motion.x;
+                    cursorY = record.motion.y;
+                    break;
+                case InputEventType::CursorScroll:
+                    scrollX += record.vector.x;
+                    scrollY += record.vector.y;
+                    break;
+                case InputEventType::CursorEnter:
+                    bCursorInside = record.toggle.bValue;
+                    break;
+                default:
+                    break;
+                }
+            }
+            // Starts a new frame, keeping held buttons but dropping edges and scroll
+            void ClearFrame() {
+                keysPressed.reset();
+                keysReleased.reset();
+                mousePressed.reset();
+                mouseReleased.reset();
+                scrollX = 0.0;
+                scrollY = 0.0;
+            }
+
+            eastl::bitset<kKeyCount> keysDown = {};
+            eastl::bitset<kKeyCount> keysPressed = {};
+            eastl::bitset<kKeyCount> keysReleased = {};
+            eastl::bitset<kMouseButtonCount> mouseDown = {};
+            eastl::bitset<kMouseButtonCount> mousePressed = {};
+            eastl::bitset<kMouseButtonCount> mouseReleased = {};
+            InputModifiers::Flags modifiers = 0;
+            f64 cursorX = 0.0;
+            f64 cursorY = 0.0;
+            // accumulated over the frame
+            f64 scrollX = 0.0;
+            f64 scrollY = 0.0;
+            bool bCursorInside = false;
+
+        private:
+            template <usize N, typename Code>
+            static bool Test(const eastl::bitset<N>& bits, Code code) {
+                const usize index = static_cast<usize>(code);
+                return index < N && bits.test(index);
+            }
+            template <usize N, typename Code>
+            static void Set(eastl::bitset<N>& down, eastl::bitset<N>& pressed, eastl::bitset<N>& released, Code code, bool bDown) {
+                // unknown keys come through as negative codes
+                const usize index = static_cast<usize>(code);
+                if (index >= N || down.test(index) == bDown) {
+                    return;
+                }
+                down.set(index, bDown);
+                (bDown ? pressed : released).set(index);
+            }
+        };
+        static_assert(eastl::is_trivially_copyable<InputSnapshot>::value, "InputSnapshot must stay trivially copyable");
+
+        // Hands snapshots from the thread polling events to any number of reader threads.
+        // A sequence lock: the sequence is odd while a store is in progress, and a reader retries
+        // its copy when the sequence was odd or moved underneath it, so it never gets a mix of two
+        // stores. The snapshot is kept as atomic words so a copy overlapping a store isn't a data race.
+        // Only one thread may Store().
+        class InputSnapshotBuffer : DeleteCopy, DeleteMove {
+        public:
+            InputSnapshotBuffer() {
+                Store({});
+            }
+
+            void Store(const InputSnapshot& snapshot) {
+                u64 words[kWordCount] = {};
+                memcpy(words, &snapshot, sizeof(InputSnapshot));
+                const u64 sequence = mSequence.load(eastl::memory_order_relaxed);
+                mSequence.store(sequence + 1, eastl::memory_order_relaxed);
+                // the odd sequence has to be visible before any of the words change
+                eastl::atomic_thread_fence(eastl::memory_order_release);
+                for (usize i = 0; i < kWordCount; ++i) {
+                    mWords[i].store(words[i], eastl::memory_order_relaxed);
+                }
+                mSequence.store(sequence + 2, eastl::memory_order_release);
+            }
+            PYRO_NODISCARD InputSnapshot Load() const {
+                u64 words[kWordCount];
+                u64 sequence;
+                do {
+                    sequence = mSequence.load(eastl::memory_order_acquire);
+                    for (usize i = 0; i < kWordCount; ++i) {
+                        words[i] = mWords[i].load(eastl::memory_order_relaxed);
+                    }
+                    // the words have to be read before the sequence is checked again
+                    eastl::atomic_thread_fence(eastl::memory_order_acquire);
+                } while ((sequence & 1) != 0 || mSequence.load(eastl::memory_order_relaxed) != sequence);
+                InputSnapshot snapshot;
+                memcpy(&snapshot, words, sizeof(InputSnapshot));
+                return snapshot;
+            }
+
+        private:
+            static constexpr usize kWordCount = (sizeof(InputSnapshot) + sizeof(u64) - 1) / sizeof(u64);
+
+            eastl::atomic<u64> mSequence = 0;
+            eastl::atomic<u64> mWords[kWordCount];
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
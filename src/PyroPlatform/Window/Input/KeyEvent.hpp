@@ -22,25 +22,24 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class KeyEvent : public InputEvent<InputEventType::Key> {
         public:
+            static constexpr eastl::string_view kName = "KeyEvent";
+
             KeyEvent(IWindow& sender, KeyCode key, i32 scanCode, InputModifiers::Flags mods, bool bDown, bool bRepeating)
                 : InputEvent(sender), kKey(key), kScanCode(scanCode), kModifiers(mods), kbDown(bDown), kbRepeating(bRepeating) {}
 
             InputEventType GetType() const override {
                 return InputEventType::Key;
             }
-            eastl::string GetName() const override {
-                return "KeyEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[20] = {};
-                snprintf(buff, 20, "%i", (int)kKey);
-                return "Key Code : " + eastl::string(buff) + " " + (kbDown ? "Down" : "Up") + (kbRepeating ? " Repeating" : "");
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Key Code : %i %s%s", static_cast<int>(kKey), kbDown ? "Down" : "Up", kbRepeating ? " Repeating" : "");
             }
 
             const KeyCode kKey;
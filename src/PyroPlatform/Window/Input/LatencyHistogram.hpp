@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/array.h>
+#include <EASTL/bit.h>
+#include <PyroCommon/Core.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Fixed size histogram of durations in nanoseconds with power of two buckets:
+        // bucket i counts samples in [2^i, 2^(i+1)), zero lands in bucket 0. Recording is a
+        // handful of integer ops and never allocates, so it can stay on in production.
+        class LatencyHistogram {
+        public:
+            static constexpr u32 kBucketCount = 64;
+
+            void Record(u64 nanoseconds) {
+                ++mBuckets[BucketOf(nanoseconds)];
+                ++mCount;
+                mTotal += nanoseconds;
+                if (nanoseconds > mMax) {
+                    mMax = nanoseconds;
+                }
+            }
+            void Reset() {
+                mBuckets.fill(0);
+                mCount = 0;
+                mTotal = 0;
+                mMax = 0;
+            }
+
+            PYRO_NODISCARD u64 GetCount() const {
+                return mCount;
+            }
+            PYRO_NODISCARD u64 GetMax() const {
+                return mMax;
+            }
+            PYRO_NODISCARD f64 GetMean() const {
+                return mCount != 0 ? static_cast<f64>(mTotal) / static_cast<f64>(mCount) : 0.0;
+            }
+            PYRO_NODISCARD u64 GetBucket(u32 bucket) const {
+                return mBuckets[bucket];
+            }
+            // Upper bound of the bucket holding the given fraction (0..1) of samples, e.g. 0.99 for p99
+            PYRO_NODISCARD u64 GetPercentile(f64 fraction) const {
+                if (mCount == 0) {
+                    return 0;
+                }
+                const u64 target = static_cast<u64>(fraction * static_cast<f64>(mCount - 1)) + 1;
+                u64 seen = 0;
+                for (u32 i = 0; i < kBucketCount; ++i) {
+                    seen += mBuckets[i];
+                    if (seen >= target) {
+                        const u64 upper = i == kBucketCount - 1 ? ~0ull : (2ull << i) - 1;
+                        return upper < mMax ? upper : mMax;
+                    }
+                }
+                return mMax;
+            }
+
+            static u32 BucketOf(u64 nanoseconds) {
+                return nanoseconds == 0 ? 0 : static_cast<u32>(eastl::bit_width(nanoseconds)) - 1;
+            }
+
+        private:
+            eastl::array<u64, kBucketCount> mBuckets = {};
+            u64 mCount = 0;
+            u64 mTotal = 0;
+            u64 mMax = 0;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
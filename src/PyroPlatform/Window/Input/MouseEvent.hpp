@@ -22,25 +22,24 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class MouseEvent : public InputEvent<InputEventType::Mouse> {
         public:
+            static constexpr eastl::string_view kName = "MouseEvent";
+
             MouseEvent(IWindow& sender, MouseButton btn, InputModifiers::Flags mods, bool bDown)
                 : InputEvent(sender), kButton(btn), kModifiers(mods), kbDown(bDown) {}
 
             InputEventType GetType() const override {
                 return InputEventType::Mouse;
             }
-            eastl::string GetName() const override {
-                return "MouseEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[20] = {};
-                snprintf(buff, 20, "%i", (int)kButton);
-                return "Mouse Button : " + eastl::string(buff) + " " + (kbDown ? "Down" : "Up");
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Mouse Button : %i %s", static_cast<int>(kButton), kbDown ? "Down" : "Up");
             }
 
             const MouseButton kButton;
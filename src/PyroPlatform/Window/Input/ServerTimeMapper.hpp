@@ -0,0 +1,80 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Maps display server event times (X11 style: milliseconds in 32 bits, wrapping every
+        // ~49 days) onto the monotonic IClock tick timebase.
+        // The offset between the two clocks is taken from the sample that arrived with the least
+        // delay, i.e. the smallest local - server difference seen so far, so a late event is placed
+        // at the time the server produced it rather than when we got around to reading it.
+        class ServerTimeMapper {
+        public:
+            ServerTimeMapper(u64 tickFrequency = 1000)
+                : mTickFrequency(tickFrequency) {}
+
+            // localTicks is the IClock tick at which the event was read, returns the mapped tick
+            u64 Map(u32 serverMilliseconds, u64 localTicks) {
+                const u64 serverTicks = Unwrap(serverMilliseconds) * mTickFrequency / 1000;
+                const i64 offset = static_cast<i64>(localTicks - serverTicks);
+                if (!bSynced || offset < mOffset) {
+                    mOffset = offset;
+                    bSynced = true;
+                }
+                return serverTicks + static_cast<u64>(mOffset);
+            }
+            // call after reconnecting to the server, its clock may have restarted
+            void Reset() {
+                bSynced = false;
+                mOffset = 0;
+                mEpoch = 0;
+                mLastServer = 0;
+            }
+
+            PYRO_NODISCARD bool IsSynced() const {
+                return bSynced;
+            }
+            PYRO_NODISCARD u64 GetTickFrequency() const {
+                return mTickFrequency;
+            }
+
+        private:
+            u64 Unwrap(u32 serverMilliseconds) {
+                // going backwards by more than half the range means the counter wrapped
+                if (bSynced && serverMilliseconds < mLastServer && mLastServer - serverMilliseconds > 0x80000000u) {
+                    mEpoch += 1ull << 32;
+                }
+                mLastServer = serverMilliseconds;
+                return mEpoch + serverMilliseconds;
+            }
+
+            u64 mTickFrequency;
+            i64 mOffset = 0;
+            u64 mEpoch = 0;
+            u32 mLastServer = 0;
+            bool bSynced = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -179,6 +179,38 @@ namespace PyroshockStudios {
             Last = Button8
         };
 
+        // Layout of a standard (Xbox style) controller, same order as SDL and GLFW
+        enum struct GamepadButton : u32 {
+            A,
+            B,
+            X,
+            Y,
+            LeftBumper,
+            RightBumper,
+            Back,
+            Start,
+            Guide,
+            LeftThumb,
+            RightThumb,
+            DpadUp,
+            DpadRight,
+            DpadDown,
+            DpadLeft,
+
+            COUNT
+        };
+        enum struct GamepadAxis : u32 {
+            LeftX,
+            LeftY,
+            RightX,
+            RightY,
+            // triggers range from 0 (released) to 1
+            LeftTrigger,
+            RightTrigger,
+
+            COUNT
+        };
+
         struct InputModifiers {
             using Flags = u32;
             enum Bits : Flags {
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string_view.h>
+#include <PyroCommon/Types.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Longest encoding of a single code point
+        constexpr usize kMaxUtf8Bytes = 4;
+
+        // Writes the UTF-8 encoding of codePoint to out and returns the number of bytes written.
+        // Code points outside of the unicode range are written as '?'.
+        constexpr usize EncodeUtf8(u32 codePoint, char* out) {
+            if (codePoint <= 0x7F) {
+                out[0] = static_cast<char>(codePoint);
+                return 1;
+            } else if (codePoint <= 0x7FF) {
+                out[0] = static_cast<char>(0xC0 | ((codePoint >> 6) & 0x1F));
+                out[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            } else if (codePoint <= 0xFFFF) {
+                out[0] = static_cast<char>(0xE0 | ((codePoint >> 12) & 0x0F));
+                out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            } else if (codePoint <= 0x10FFFF) {
+                out[0] = static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07));
+                out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 4;
+            }
+            // Invalid code point
+            out[0] = '?';
+            return 1;
+        }
+
+        // Reads the code point text starts with and returns the number of bytes it took, 0 for empty text.
+        // Malformed, overlong and surrogate sequences read as U+FFFD and consume a single byte.
+        constexpr usize DecodeUtf8(eastl::string_view text, u32& codePoint) {
+            constexpr u32 kReplacement = 0xFFFD;
+            if (text.empty()) {
+                return 0;
+            }
+            const u8 lead = static_cast<u8>(text[0]);
+            usize length = 0;
+            u32 value = 0;
+            u32 minimum = 0;
+            if (lead <= 0x7F) {
+                codePoint = lead;
+                return 1;
+            } else if ((lead & 0xE0) == 0xC0) {
+                length = 2;
+                value = lead & 0x1F;
+                minimum = 0x80;
+            } else if ((lead & 0xF0) == 0xE0) {
+                length = 3;
+                value = lead & 0x0F;
+                minimum = 0x800;
+            } else if ((lead & 0xF8) == 0xF0) {
+                length = 4;
+                value = lead & 0x07;
+                minimum = 0x10000;
+            } else {
+                codePoint = kReplacement;
+                return 1;
+            }
+            if (text.size() < length) {
+                codePoint = kReplacement;
+                return 1;
+            }
+            for (usize i = 1; i < length; ++i) {
+                const u8 next = static_cast<u8>(text[i]);
+                if ((next & 0xC0) != 0x80) {
+                    codePoint = kReplacement;
+                    return 1;
+                }
+                value = (value << 6) | (next & 0x3F);
+            }
+            if (value < minimum || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+                codePoint = kReplacement;
+                return 1;
+            }
+            codePoint = value;
+            return length;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
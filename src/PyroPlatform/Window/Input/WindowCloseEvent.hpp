@@ -22,12 +22,13 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class WindowCloseEvent : public InputEvent<InputEventType::WindowClose> {
         public:
+            static constexpr eastl::string_view kName = "WindowCloseEvent";
+
             WindowCloseEvent(IWindow& sender)
                 : InputEvent(sender) {
             }
@@ -35,11 +36,11 @@ namespace PyroshockStudios {
             InputEventType GetType() const override {
                 return InputEventType::WindowClose;
             }
-            eastl::string GetName() const override {
-                return "WindowCloseEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                return "Window Close";
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "%s", "Window Close");
             }
         };
     } // namespace Platform
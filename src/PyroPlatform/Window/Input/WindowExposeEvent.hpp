@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEvent.hpp"
+#include <EASTL/span.h>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Parts of the window whose contents were lost (uncovered, mapped, resized) and have to be
+        // drawn again. A series the windowing system reports together is delivered in one dispatch.
+        // The rectangles are only valid for the duration of the dispatch, copy them out if needed later.
+        class WindowExposeEvent : public InputEvent<InputEventType::WindowExpose> {
+        public:
+            static constexpr eastl::string_view kName = "WindowExposeEvent";
+
+            WindowExposeEvent(IWindow& sender, eastl::span<const WindowRect> rects)
+                : InputEvent(sender), kRects(rects), kBounds(Bounds(rects)) {}
+
+            InputEventType GetType() const override {
+                return InputEventType::WindowExpose;
+            }
+            eastl::string_view GetName() const override {
+                return kName;
+            }
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Expose: %zu rects in (%d, %d, %u, %u)", kRects.size(), kBounds.x, kBounds.y, kBounds.width, kBounds.height);
+            }
+
+            // in framebuffer pixels
+            const eastl::span<const WindowRect> kRects;
+            // the smallest rectangle holding all of them
+            const WindowRect kBounds;
+
+        private:
+            static WindowRect Bounds(eastl::span<const WindowRect> rects) {
+                if (rects.empty()) {
+                    return {};
+                }
+                i64 left = rects[0].x;
+                i64 top = rects[0].y;
+                i64 right = left + rects[0].width;
+                i64 bottom = top + rects[0].height;
+                for (const WindowRect& rect : rects) {
+                    left = eastl::min<i64>(left, rect.x);
+                    top = eastl::min<i64>(top, rect.y);
+                    right = eastl::max<i64>(right, static_cast<i64>(rect.x) + rect.width);
+                    bottom = eastl::max<i64>(bottom, static_cast<i64>(rect.y) + rect.height);
+                }
+                return { static_cast<i32>(left), static_cast<i32>(top), static_cast<u32>(right - left), static_cast<u32>(bottom - top) };
+            }
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -22,12 +22,13 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class WindowFocusEvent : public InputEvent<InputEventType::WindowFocus> {
         public:
+            static constexpr eastl::string_view kName = "WindowFocusEvent";
+
             WindowFocusEvent(IWindow& sender, bool bFocussed)
                 : InputEvent(sender), kbFocused(bFocussed) {
             }
@@ -35,11 +36,11 @@ namespace PyroshockStudios {
             InputEventType GetType() const override {
                 return InputEventType::WindowFocus;
             }
-            eastl::string GetName() const override {
-                return "WindowFocusEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                return eastl::string("Window ") + (kbFocused ? "Focussed" : "Unfocussed");
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window %s", kbFocused ? "Focussed" : "Unfocussed");
             }
 
             const bool kbFocused = false;
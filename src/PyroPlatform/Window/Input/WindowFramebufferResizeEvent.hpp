@@ -0,0 +1,50 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEvent.hpp"
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class WindowFramebufferResizeEvent : public InputEvent<InputEventType::WindowFramebufferResize> {
+        public:
+            static constexpr eastl::string_view kName = "WindowFramebufferResizeEvent";
+
+            WindowFramebufferResizeEvent(IWindow& sender, u32 width, u32 height)
+                : InputEvent(sender), kWidth(width), kHeight(height) {}
+
+            InputEventType GetType() const override {
+                return InputEventType::WindowFramebufferResize;
+            }
+            eastl::string_view GetName() const override {
+                return kName;
+            }
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Framebuffer Resize: (%u, %u)", kWidth, kHeight);
+            }
+
+            // in pixels
+            const u32 kWidth;
+            const u32 kHeight;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
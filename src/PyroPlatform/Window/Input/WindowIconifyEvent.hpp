@@ -0,0 +1,48 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEvent.hpp"
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class WindowIconifyEvent : public InputEvent<InputEventType::WindowIconify> {
+        public:
+            static constexpr eastl::string_view kName = "WindowIconifyEvent";
+
+            WindowIconifyEvent(IWindow& sender, bool bIconified)
+                : InputEvent(sender), kbIconified(bIconified) {}
+
+            InputEventType GetType() const override {
+                return InputEventType::WindowIconify;
+            }
+            eastl::string_view GetName() const override {
+                return kName;
+            }
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Iconify: %s", kbIconified ? "Iconified" : "Restored");
+            }
+
+            const bool kbIconified;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -22,12 +22,13 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class WindowPositionEvent : public InputEvent<InputEventType::WindowPosition> {
         public:
+            static constexpr eastl::string_view kName = "WindowPositionEvent";
+
             WindowPositionEvent(IWindow& sender, f64 x, f64 y)
                 : InputEvent(sender), kX(x), kY(y) {
             }
@@ -35,13 +36,11 @@ namespace PyroshockStudios {
             InputEventType GetType() const override {
                 return InputEventType::WindowPosition;
             }
-            eastl::string GetName() const override {
-                return "WindowPositionEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[64] = {};
-                snprintf(buff, 64, "(%.2lf, %.2lf)", kX, kY);
-                return "Window Position : " + eastl::string(buff);
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Position : (%.2lf, %.2lf)", kX, kY);
             }
 
             const f64 kX;
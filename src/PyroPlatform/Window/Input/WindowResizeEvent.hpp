@@ -22,25 +22,24 @@
 
 #pragma once
 #include "InputEvent.hpp"
-#include <cstdio>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         class WindowResizeEvent : public InputEvent<InputEventType::WindowResize> {
         public:
+            static constexpr eastl::string_view kName = "WindowResizeEvent";
+
             WindowResizeEvent(IWindow& sender, u32 width, u32 height)
                 : InputEvent(sender), kWidth(width), kHeight(height) {}
 
             InputEventType GetType() const override {
                 return InputEventType::WindowResize;
             }
-            eastl::string GetName() const override {
-                return "WindowResizeEvent";
+            eastl::string_view GetName() const override {
+                return kName;
             }
-            eastl::string ToString() const override {
-                char buff[64] = {};
-                snprintf(buff, 64, "(%u, %u)", kWidth, kHeight);
-                return eastl::string("Window Resize: ") + buff;
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Resize: (%u, %u)", kWidth, kHeight);
             }
 
             const u32 kWidth;
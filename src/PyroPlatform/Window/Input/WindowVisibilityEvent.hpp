@@ -0,0 +1,69 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "InputEvent.hpp"
+
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Sent when the window is covered, uncovered, hidden or iconified, see IWindow::GetVisibilityState.
+        class WindowVisibilityEvent : public InputEvent<InputEventType::WindowVisibility> {
+        public:
+            static constexpr eastl::string_view kName = "WindowVisibilityEvent";
+
+            WindowVisibilityEvent(IWindow& sender, WindowVisibilityState state)
+                : InputEvent(sender), kState(state) {}
+
+            InputEventType GetType() const override {
+                return InputEventType::WindowVisibility;
+            }
+            eastl::string_view GetName() const override {
+                return kName;
+            }
+            usize FormatTo(char* buffer, usize capacity) const override {
+                return Format(buffer, capacity, "Window Visibility: %s", GetStateName(kState));
+            }
+
+            PYRO_NODISCARD bool IsVisible() const {
+                return kState == WindowVisibilityState::Visible || kState == WindowVisibilityState::PartiallyObscured;
+            }
+
+            static const char* GetStateName(WindowVisibilityState state) {
+                switch (state) {
+                case WindowVisibilityState::Visible:
+                    return "Visible";
+                case WindowVisibilityState::PartiallyObscured:
+                    return "Partially Obscured";
+                case WindowVisibilityState::FullyObscured:
+                    return "Fully Obscured";
+                case WindowVisibilityState::Iconified:
+                    return "Iconified";
+                }
+                return "Unknown";
+            }
+
+            const WindowVisibilityState kState;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
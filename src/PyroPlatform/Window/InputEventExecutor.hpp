@@ -0,0 +1,133 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/array.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Window/Input/InputEventRing.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Runs event handlers away from the thread that polls events. Every record of a type bound here
+        // is copied into a lock-free ring by the attached WindowEvents, and the handlers run whenever Run()
+        // is called: from a worker thread loop, a job, or later on the main thread.
+        //
+        // Bind handlers before attaching or from inside Run(). They cannot consume events for inline
+        // handlers, and the sender window is only an identity here, don't call into it off its thread.
+        class InputEventExecutor : DeleteCopy, DeleteMove {
+        public:
+            InputEventExecutor(eastl::string_view name, u32 capacity = 1024)
+                : mName(name.data(), name.size()), mRing(capacity) {}
+            ~InputEventExecutor() {
+                for (WindowEvents* events : mAttached) {
+                    events->DetachRing(mRing);
+                }
+            }
+
+            PYRO_NODISCARD eastl::string_view GetName() const {
+                return { mName.data(), mName.size() };
+            }
+
+            void Attach(WindowEvents& events) {
+                mAttached.push_back(&events);
+                events.AttachRing(mRing);
+            }
+            void Detach(WindowEvents& events) {
+                for (auto it = mAttached.begin(); it != mAttached.end(); ++it) {
+                    if (*it == &events) {
+                        events.DetachRing(mRing);
+                        mAttached.erase(it);
+                        return;
+                    }
+                }
+            }
+
+            template <typename Event>
+            PYRO_NODISCARD InputEventHandle<Event> BindEvent(DispatchableEvent<Event>&& fn, i32 priority = 0, InputBindSite site = InputBindSite::current()) {
+                static_assert(WindowEvents::BuiltinEvents::kContains<Event>, "Only events built from input records can be offloaded!");
+                const InputEventType type = RecordTypeOf<Event>();
+                if (mBoundCounts[static_cast<usize>(type)]++ == 0) {
+                    mRing.Want(type);
+                }
+                return mEvents.BindEvent<Event>(eastl::move(fn), priority, site);
+            }
+            // Once the last handler of a record type is gone its records stop being copied into the ring
+            template <typename Event>
+            bool UnbindEvent(InputEventHandle<Event> handle) {
+                if (!mEvents.UnbindEvent(handle)) {
+                    return false;
+                }
+                const InputEventType type = RecordTypeOf<Event>();
+                if (--mBoundCounts[static_cast<usize>(type)] == 0) {
+                    mRing.Unwant(type);
+                }
+                return true;
+            }
+
+            // Dispatches everything queued so far on the calling thread, returns how many records that was
+            usize Run() {
+                usize count = 0;
+                InputEventRing::Entry entry;
+                while (mRing.Pop(entry)) {
+                    mEvents.Dispatch(*entry.window, entry.record);
+                    ++count;
+                }
+                mEvents.FlushText();
+                return count;
+            }
+
+            // Offloaded handler latency, the queue latency includes the time spent in the ring
+            void SetClock(IClock* clock) {
+                mEvents.SetClock(clock);
+            }
+            PYRO_NODISCARD const WindowEvents& GetEvents() const {
+                return mEvents;
+            }
+            PYRO_NODISCARD const InputEventRing& GetRing() const {
+                return mRing;
+            }
+
+        private:
+            template <typename Event>
+            static constexpr InputEventType RecordTypeOf() {
+                if constexpr (eastl::is_same_v<Event, TextInputEvent>) {
+                    // text runs are rebuilt from the character records
+                    return InputEventType::CharInput;
+                } else {
+                    return Event::Type;
+                }
+            }
+
+            eastl::string mName;
+            InputEventRing mRing;
+            WindowEvents mEvents = {};
+            eastl::vector<WindowEvents*> mAttached = {};
+            // handlers bound per record type, the ring wants the types with any
+            eastl::array<u32, static_cast<usize>(InputEventType::COUNT)> mBoundCounts = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
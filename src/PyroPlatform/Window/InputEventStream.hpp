@@ -0,0 +1,101 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Window/Input/InputEventRecord.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        struct IWindow;
+
+        // Collects the records of every window into one batch ordered by timestamp (arrival order
+        // breaks ties) and dispatches them through a single WindowEvents, each event carrying the
+        // window it came from as its sender. Handlers bound here see every current and future window.
+        class InputEventStream {
+        public:
+            struct Entry {
+                IWindow* window;
+                InputEventRecord record;
+            };
+
+            InputEventStream() = default;
+
+            PYRO_NODISCARD WindowEvents& GetEvents() {
+                return mEvents;
+            }
+
+            void Push(IWindow& window, const InputEventRecord& record) {
+                const auto later = [](const InputEventRecord& lhs, const Entry& rhs) {
+                    return lhs.timestamp < rhs.record.timestamp ||
+                           (lhs.timestamp == rhs.record.timestamp && lhs.sequence < rhs.record.sequence);
+                };
+                // records almost always arrive in order, so this is an append
+                if (mBatch.empty() || !later(record, mBatch.back())) {
+                    mBatch.push_back({ &window, record });
+                    return;
+                }
+                mBatch.insert(eastl::upper_bound(mBatch.begin(), mBatch.end(), record, later), Entry{ &window, record });
+            }
+            // Drops everything still batched for a window that is going away, safe to call from a handler
+            void Remove(const IWindow* window) {
+                mBatch.erase(eastl::remove_if(mBatch.begin(), mBatch.end(), [window](const Entry& entry) { return entry.window == window; }),
+                    mBatch.end());
+                for (Entry& entry : mDispatching) {
+                    if (entry.window == window) {
+                        entry.window = nullptr;
+                    }
+                }
+            }
+            // Dispatches the batch. Records pushed by handlers while this runs wait for the next call.
+            void Dispatch() {
+                if (bDispatching || mBatch.empty()) {
+                    return;
+                }
+                eastl::swap(mBatch, mDispatching);
+                bDispatching = true;
+                for (const Entry& entry : mDispatching) {
+                    if (entry.window != nullptr) {
+                        mEvents.Dispatch(*entry.window, entry.record);
+                    }
+                }
+                mEvents.FlushText();
+                bDispatching = false;
+                mDispatching.clear();
+            }
+            PYRO_NODISCARD usize GetPendingCount() const {
+                return mBatch.size();
+            }
+
+        private:
+            WindowEvents mEvents = {};
+            // both keep their capacity between polls
+            eastl::vector<Entry> mBatch = {};
+            eastl::vector<Entry> mDispatching = {};
+            bool bDispatching = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
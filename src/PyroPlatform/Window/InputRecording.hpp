@@ -0,0 +1,224 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Binary input log layout. A header followed by fixed size entries, all 8 byte aligned and
+        // in native byte order, so a memory mapped file can be viewed in place with InputRecordingView.
+        struct InputRecordingHeader {
+            static constexpr u32 kMagic = 0x52495950; // "PYIR"
+            static constexpr u32 kVersion = 1;
+
+            u32 magic = kMagic;
+            u32 version = kVersion;
+            // ticks per second of the record timestamps, 0 when they were recorded without a clock
+            u64 tickFrequency = 0;
+        };
+        struct InputRecordingEntry {
+            u32 windowId;
+            u32 reserved;
+            InputEventRecord record;
+        };
+        static_assert(sizeof(InputRecordingHeader) % alignof(InputRecordingEntry) == 0, "Entries must stay aligned after the header");
+        static_assert(eastl::is_trivially_copyable<InputRecordingEntry>::value, "InputRecordingEntry must stay POD");
+
+        // Read-only view over a recording, does not copy or own the bytes.
+        // The bytes must be 8 byte aligned, which any mapping or heap allocation is.
+        class InputRecordingView {
+        public:
+            InputRecordingView() = default;
+            InputRecordingView(eastl::span<const u8> bytes) {
+                const bool bAligned = reinterpret_cast<uintptr_t>(bytes.data()) % alignof(InputRecordingEntry) == 0;
+                if (!bAligned || bytes.size() < sizeof(InputRecordingHeader)) {
+                    return;
+                }
+                memcpy(&mHeader, bytes.data(), sizeof(InputRecordingHeader));
+                if (mHeader.magic != InputRecordingHeader::kMagic || mHeader.version != InputRecordingHeader::kVersion) {
+                    return;
+                }
+                const usize count = (bytes.size() - sizeof(InputRecordingHeader)) / sizeof(InputRecordingEntry);
+                mEntries = { reinterpret_cast<const InputRecordingEntry*>(bytes.data() + sizeof(InputRecordingHeader)), count };
+                bValid = true;
+            }
+
+            PYRO_NODISCARD bool IsValid() const {
+                return bValid;
+            }
+            PYRO_NODISCARD const InputRecordingHeader& GetHeader() const {
+                return mHeader;
+            }
+            PYRO_NODISCARD eastl::span<const InputRecordingEntry> GetEntries() const {
+                return mEntries;
+            }
+
+        private:
+            InputRecordingHeader mHeader = {};
+            eastl::span<const InputRecordingEntry> mEntries = {};
+            bool bValid = false;
+        };
+
+        // Appends every record dispatched through the attached WindowEvents to an in-memory log.
+        // Each attached window gets an id, in attach order, that the player uses to route entries back.
+        class InputRecorder : DeleteCopy, DeleteMove {
+        public:
+            InputRecorder(u64 tickFrequency = 0) {
+                InputRecordingHeader header = {};
+                header.tickFrequency = tickFrequency;
+                mBytes.resize(sizeof(InputRecordingHeader));
+                memcpy(mBytes.data(), &header, sizeof(InputRecordingHeader));
+            }
+            ~InputRecorder() {
+                for (const Attachment& attached : mAttached) {
+                    attached.events->RemoveRecordObserver(attached.observer);
+                }
+            }
+
+            // Other observers of the same WindowEvents, including other recorders, are left alone
+            u32 Attach(WindowEvents& events) {
+                const u32 windowId = mNextWindowId++;
+                const WindowEvents::RecordObserverHandle observer =
+                    events.AddRecordObserver({ [this, windowId](const InputEventRecord& record) { Write(windowId, record); } });
+                mAttached.push_back({ &events, observer });
+                return windowId;
+            }
+            void Detach(WindowEvents& events) {
+                for (auto it = mAttached.begin(); it != mAttached.end(); ++it) {
+                    if (it->events == &events) {
+                        events.RemoveRecordObserver(it->observer);
+                        mAttached.erase(it);
+                        return;
+                    }
+                }
+            }
+
+            void Write(u32 windowId, const InputEventRecord& record) {
+                const InputRecordingEntry entry = { windowId, 0, record };
+                const usize offset = mBytes.size();
+                mBytes.resize(offset + sizeof(InputRecordingEntry));
+                memcpy(mBytes.data() + offset, &entry, sizeof(InputRecordingEntry));
+            }
+
+            PYRO_NODISCARD eastl::span<const u8> GetBytes() const {
+                return { mBytes.data(), mBytes.size() };
+            }
+            PYRO_NODISCARD usize GetEntryCount() const {
+                return (mBytes.size() - sizeof(InputRecordingHeader)) / sizeof(InputRecordingEntry);
+            }
+            bool SaveToFile(const char* path) const {
+                FILE* file = fopen(path, "wb");
+                if (file == nullptr) {
+                    return false;
+                }
+                const bool bWritten = fwrite(mBytes.data(), 1, mBytes.size(), file) == mBytes.size();
+                return fclose(file) == 0 && bWritten;
+            }
+
+        private:
+            struct Attachment {
+                WindowEvents* events;
+                WindowEvents::RecordObserverHandle observer;
+            };
+
+            eastl::vector<u8> mBytes;
+            eastl::vector<Attachment> mAttached;
+            u32 mNextWindowId = 0;
+        };
+
+        // Feeds a recording back through WindowEvents, either as fast as possible or paced by the
+        // recorded timestamps. Entries for windows that were not bound are skipped.
+        class InputPlayer {
+        public:
+            InputPlayer(InputRecordingView recording)
+                : mRecording(recording) {}
+
+            void BindWindow(u32 windowId, IWindow& window, WindowEvents& events) {
+                if (windowId >= mTargets.size()) {
+                    mTargets.resize(windowId + 1);
+                }
+                mTargets[windowId] = { &window, &events };
+            }
+
+            // Dispatches everything that is left, returns the number of entries played
+            usize PlayAll() {
+                return PlayCount(mRecording.GetEntries().size() - mNext);
+            }
+            // Dispatches entries recorded up to elapsedSeconds after the first one
+            usize PlayUntil(f64 elapsedSeconds) {
+                const eastl::span<const InputRecordingEntry> entries = mRecording.GetEntries();
+                const u64 frequency = mRecording.GetHeader().tickFrequency;
+                if (entries.empty() || frequency == 0) {
+                    // no timing information, nothing to pace against
+                    return PlayAll();
+                }
+                const u64 first = entries[0].record.timestamp;
+                const u64 limit = first + static_cast<u64>(elapsedSeconds * static_cast<f64>(frequency));
+                usize count = 0;
+                while (mNext + count < entries.size() && entries[mNext + count].record.timestamp <= limit) {
+                    ++count;
+                }
+                return PlayCount(count);
+            }
+            void Restart() {
+                mNext = 0;
+            }
+            PYRO_NODISCARD bool IsFinished() const {
+                return mNext >= mRecording.GetEntries().size();
+            }
+
+        private:
+            struct Target {
+                IWindow* window = nullptr;
+                WindowEvents* events = nullptr;
+            };
+
+            usize PlayCount(usize count) {
+                const eastl::span<const InputRecordingEntry> entries = mRecording.GetEntries();
+                for (usize i = 0; i < count; ++i) {
+                    const InputRecordingEntry& entry = entries[mNext++];
+                    if (entry.windowId < mTargets.size() && mTargets[entry.windowId].events != nullptr) {
+                        mTargets[entry.windowId].events->Dispatch(*mTargets[entry.windowId].window, entry.record);
+                    }
+                }
+                for (const Target& target : mTargets) {
+                    if (target.events != nullptr) {
+                        target.events->FlushText();
+                    }
+                }
+                return count;
+            }
+
+            InputRecordingView mRecording;
+            eastl::vector<Target> mTargets;
+            usize mNext = 0;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
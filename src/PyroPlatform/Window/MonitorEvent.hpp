@@ -0,0 +1,51 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string_view.h>
+#include <PyroCommon/Core.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        struct IMonitor;
+
+        enum struct MonitorEventType : i32 {
+            Connected,
+            // the monitor is still valid during the dispatch, it is destroyed right after
+            Disconnected,
+            // position, work area, content scale or video mode changed
+            Changed
+        };
+
+        // Emitted through IWindowManager::GetEvents(), bind it like any other event
+        class MonitorEvent : DeleteCopy {
+        public:
+            static constexpr eastl::string_view kName = "MonitorEvent";
+
+            MonitorEvent(IMonitor& monitor, MonitorEventType type)
+                : kMonitor(&monitor), kType(type) {}
+
+            IMonitor* const kMonitor;
+            const MonitorEventType kType;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
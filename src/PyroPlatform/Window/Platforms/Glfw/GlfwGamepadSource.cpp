@@ -0,0 +1,79 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "GlfwGamepadSource.hpp"
+#define GLFW_NATIVE_INCLUDE_NONE
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        static_assert(GlfwGamepadSource::kSlotCount == GLFW_JOYSTICK_LAST + 1, "Slot count does not match GLFW!");
+        static_assert(GamepadState::kAxisCount == GLFW_GAMEPAD_AXIS_LAST + 1, "GLFW gamepad axes are not in GamepadAxis order!");
+        static_assert(GamepadState::kButtonCount == GLFW_GAMEPAD_BUTTON_LAST + 1, "GLFW gamepad buttons are not in GamepadButton order!");
+
+        u32 GlfwGamepadSource::GetSlotCount() const {
+            return kSlotCount;
+        }
+        bool GlfwGamepadSource::QueryDevice(u32 slot, GamepadDeviceState& state) {
+            const int jid = static_cast<int>(slot);
+            if (slot >= kSlotCount || !glfwJoystickPresent(jid)) {
+                return false;
+            }
+            const char* guid = glfwGetJoystickGUID(jid);
+            state.guid = guid ? eastl::string_view(guid) : eastl::string_view();
+
+            // GLFW maps pads its SDL database knows, in the same order as GamepadAxis and GamepadButton
+            GLFWgamepadstate gamepad;
+            if (glfwJoystickIsGamepad(jid) && glfwGetGamepadState(jid, &gamepad)) {
+                for (u32 i = 0; i < GamepadState::kAxisCount; ++i) {
+                    mAxes[slot][i] = gamepad.axes[i];
+                }
+                for (u32 i = 0; i < GamepadState::kButtonCount; ++i) {
+                    mButtons[slot][i] = gamepad.buttons[i];
+                }
+                const char* name = glfwGetGamepadName(jid);
+                state.name = name ? eastl::string_view(name) : eastl::string_view();
+                state.axes = { mAxes[slot], GamepadState::kAxisCount };
+                state.buttons = { mButtons[slot], GamepadState::kButtonCount };
+                state.hats = {};
+                state.layout = GamepadLayout::Standard;
+                return true;
+            }
+
+            int axisCount = 0;
+            int buttonCount = 0;
+            int hatCount = 0;
+            const float* axes = glfwGetJoystickAxes(jid, &axisCount);
+            const unsigned char* buttons = glfwGetJoystickButtons(jid, &buttonCount);
+            const unsigned char* hats = glfwGetJoystickHats(jid, &hatCount);
+            const char* name = glfwGetJoystickName(jid);
+
+            state.name = name ? eastl::string_view(name) : eastl::string_view();
+            state.axes = { axes, axes ? static_cast<usize>(axisCount) : 0 };
+            state.buttons = { buttons, buttons ? static_cast<usize>(buttonCount) : 0 };
+            state.hats = { hats, hats ? static_cast<usize>(hatCount) : 0 };
+            state.layout = GamepadLayout::Unknown;
+            return true;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
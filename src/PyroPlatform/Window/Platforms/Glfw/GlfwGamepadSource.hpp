@@ -0,0 +1,50 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IGamepadInput.hpp>
+#ifdef PYRO_PLATFORM_WINDOWING_GLFW
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Reads GLFW joysticks. Pads in GLFW's built-in gamepad database come out already mapped, the
+        // rest are raw and need a mapping from IGamepadInput::AddMappings(). Needs
+        // GLFW_JOYSTICK_HAT_BUTTONS off so raw button indices match SDL mappings.
+        class GlfwGamepadSource : public IGamepadSource, DeleteCopy, DeleteMove {
+        public:
+            static constexpr u32 kSlotCount = 16;
+
+            GlfwGamepadSource() = default;
+            ~GlfwGamepadSource() override = default;
+
+            u32 GetSlotCount() const override;
+            bool QueryDevice(u32 slot, GamepadDeviceState& state) override;
+
+        private:
+            // mapped gamepad state, the device state views point in here
+            f32 mAxes[kSlotCount][GamepadState::kAxisCount] = {};
+            u8 mButtons[kSlotCount][GamepadState::kButtonCount] = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
+#endif
@@ -21,57 +21,156 @@
 // SOFTWARE.
 
 #include "GlfwMonitor.hpp"
+#include <EASTL/algorithm.h>
+#ifdef PYRO_PLATFORM_LINUX
+#define GLFW_EXPOSE_NATIVE_X11
+#include <X11/Xlib.h>
+#include <X11/extensions/Xrandr.h>
+#endif
 #define GLFW_NATIVE_INCLUDE_NONE
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
+#ifdef PYRO_PLATFORM_LINUX
+#include <GLFW/glfw3native.h>
+#endif
 
 namespace PyroshockStudios {
     inline namespace Platform {
+        namespace {
+            VideoMode ToVideoMode(const GLFWvidmode& mode) {
+                VideoMode result = {};
+                result.resolution = Size(static_cast<u32>(mode.width), static_cast<u32>(mode.height));
+                result.refreshRate = static_cast<u32>(mode.refreshRate);
+                result.redBits = static_cast<u32>(mode.redBits);
+                result.greenBits = static_cast<u32>(mode.greenBits);
+                result.blueBits = static_cast<u32>(mode.blueBits);
+                return result;
+            }
+
+            // Rate of the monitor's current mode from its XRandR timings, invalid if unavailable
+            RefreshRate QueryPreciseRefreshRate(GLFWmonitor* monitor) {
+#ifdef PYRO_PLATFORM_LINUX
+                if (glfwGetPlatform() != GLFW_PLATFORM_X11) {
+                    return {};
+                }
+                Display* display = glfwGetX11Display();
+                const RRCrtc crtc = glfwGetX11Adapter(monitor);
+                if (!display || crtc == 0) {
+                    return {};
+                }
+                XRRScreenResources* resources = XRRGetScreenResourcesCurrent(display, DefaultRootWindow(display));
+                if (!resources) {
+                    return {};
+                }
+                RefreshRate rate = {};
+                if (XRRCrtcInfo* crtcInfo = XRRGetCrtcInfo(display, resources, crtc)) {
+                    for (int i = 0; i < resources->nmode; ++i) {
+                        const XRRModeInfo& mode = resources->modes[i];
+                        if (mode.id == crtcInfo->mode) {
+                            rate = RefreshRate::FromModeTimings(mode.dotClock, mode.hTotal, mode.vTotal,
+                                (mode.modeFlags & RR_Interlace) != 0, (mode.modeFlags & RR_DoubleScan) != 0);
+                            break;
+                        }
+                    }
+                    XRRFreeCrtcInfo(crtcInfo);
+                }
+                XRRFreeScreenResources(resources);
+                return rate;
+#else
+                return {};
+#endif
+            }
+        } // namespace
+
         GlfwMonitor::GlfwMonitor(GLFWmonitor* monitor)
             : mMonitor(monitor) {
+            glfwSetMonitorUserPointer(mMonitor, this);
+            const char* name = glfwGetMonitorName(mMonitor);
+            mName = name ? eastl::string(name) : eastl::string("NAME_ERROR");
+            Refresh();
         }
         GlfwMonitor::~GlfwMonitor() {
+            glfwSetMonitorUserPointer(mMonitor, nullptr);
+        }
+
+        GlfwMonitor* GlfwMonitor::Get(GLFWmonitor* monitor) {
+            return reinterpret_cast<GlfwMonitor*>(glfwGetMonitorUserPointer(monitor));
         }
 
         eastl::string GlfwMonitor::GetName() const {
-            const char* name = glfwGetMonitorName(mMonitor);
-            return name ? eastl::string(name) : eastl::string("NAME_ERROR");
+            return mName;
         }
 
         Point GlfwMonitor::GetPosition() const {
-            int x, y;
-            glfwGetMonitorPos(mMonitor, &x, &y);
-            return Point(x, y);
+            return mCache.position;
         }
 
         Size GlfwMonitor::GetPhysicalSize() const {
-            int widthMM, heightMM;
-            glfwGetMonitorPhysicalSize(mMonitor, &widthMM, &heightMM);
-            return Size(widthMM, heightMM);
+            return mCache.physicalSize;
         }
 
         Size GlfwMonitor::GetResolution() const {
-            const GLFWvidmode* mode = glfwGetVideoMode(mMonitor);
-            if (!mode)
-                return {};
-            return { static_cast<u32>(mode->width), static_cast<u32>(mode->height) };
+            return mCache.currentMode.resolution;
         }
 
         Size GlfwMonitor::GetWorkArea() const {
-            int x, y;
-            glfwGetMonitorWorkarea(mMonitor, nullptr, nullptr, &x, &y);
-            return Size(static_cast<u32>(x), static_cast<u32>(y));
+            return mCache.workArea;
         }
 
         FSize GlfwMonitor::GetContentScale() const {
-            float xScale = 1.0f, yScale = 1.0f;
-            glfwGetMonitorContentScale(mMonitor, &xScale, &yScale);
-            return FSize(xScale, yScale);
+            return mCache.contentScale;
         }
 
         u32 GlfwMonitor::GetRefreshRate() const {
-            const GLFWvidmode* mode = glfwGetVideoMode(mMonitor);
-            return mode ? static_cast<u32>(mode->refreshRate) : 0;
+            return mCache.currentMode.refreshRate;
+        }
+
+        RefreshRate GlfwMonitor::GetPreciseRefreshRate() const {
+            return mCache.preciseRefreshRate;
+        }
+
+        VideoMode GlfwMonitor::GetCurrentVideoMode() const {
+            return mCache.currentMode;
+        }
+
+        eastl::span<const VideoMode> GlfwMonitor::GetVideoModes() const {
+            return { mCache.modes.data(), mCache.modes.size() };
+        }
+
+        bool GlfwMonitor::Refresh() {
+            PropertyCache cache = {};
+            int x, y, width, height;
+            glfwGetMonitorPos(mMonitor, &x, &y);
+            cache.position = Point(x, y);
+            glfwGetMonitorPhysicalSize(mMonitor, &width, &height);
+            cache.physicalSize = Size(width, height);
+            glfwGetMonitorWorkarea(mMonitor, nullptr, nullptr, &width, &height);
+            cache.workArea = Size(static_cast<u32>(width), static_cast<u32>(height));
+            float xScale = 1.0f, yScale = 1.0f;
+            glfwGetMonitorContentScale(mMonitor, &xScale, &yScale);
+            cache.contentScale = FSize(xScale, yScale);
+            if (const GLFWvidmode* mode = glfwGetVideoMode(mMonitor)) {
+                cache.currentMode = ToVideoMode(*mode);
+            }
+            cache.preciseRefreshRate = QueryPreciseRefreshRate(mMonitor);
+            if (!cache.preciseRefreshRate.IsValid()) {
+                cache.preciseRefreshRate = RefreshRate::FromHertz(cache.currentMode.refreshRate);
+            }
+            int count = 0;
+            const GLFWvidmode* modes = glfwGetVideoModes(mMonitor, &count);
+            cache.modes.reserve(static_cast<usize>(count));
+            for (int i = 0; i < count; ++i) {
+                cache.modes.push_back(ToVideoMode(modes[i]));
+            }
+
+            const bool bChanged = cache.position.x != mCache.position.x || cache.position.y != mCache.position.y ||
+                                  cache.physicalSize.width != mCache.physicalSize.width || cache.physicalSize.height != mCache.physicalSize.height ||
+                                  cache.workArea.width != mCache.workArea.width || cache.workArea.height != mCache.workArea.height ||
+                                  cache.contentScale.width != mCache.contentScale.width || cache.contentScale.height != mCache.contentScale.height ||
+                                  cache.currentMode != mCache.currentMode || cache.preciseRefreshRate != mCache.preciseRefreshRate || cache.modes.size() != mCache.modes.size() ||
+                                  !eastl::equal(cache.modes.begin(), cache.modes.end(), mCache.modes.begin());
+            mCache = eastl::move(cache);
+            return bChanged;
         }
     } // namespace Platform
 } // namespace PyroshockStudios
@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #pragma once
+#include <EASTL/vector.h>
 #include <PyroCommon/Core.hpp>
 #include <PyroPlatform/Window/IMonitor.hpp>
 
@@ -41,13 +42,32 @@ namespace PyroshockStudios {
             Size GetWorkArea() const override;
             FSize GetContentScale() const override;
             u32 GetRefreshRate() const override;
+            RefreshRate GetPreciseRefreshRate() const override;
+            VideoMode GetCurrentVideoMode() const override;
+            eastl::span<const VideoMode> GetVideoModes() const override;
+
+            // Re-reads every property from GLFW, returns true if anything changed
+            bool Refresh();
 
             GLFWmonitor* GetGLFWMonitor() const {
                 return mMonitor;
             }
+            static GlfwMonitor* Get(GLFWmonitor* monitor);
 
         private:
+            struct PropertyCache {
+                Point position = {};
+                Size physicalSize = {};
+                Size workArea = {};
+                FSize contentScale = {};
+                VideoMode currentMode = {};
+                RefreshRate preciseRefreshRate = {};
+                eastl::vector<VideoMode> modes = {};
+            };
+
             GLFWmonitor* mMonitor = nullptr;
+            eastl::string mName;
+            PropertyCache mCache = {};
         };
     } // namespace Platform
 } // namespace PyroshockStudios
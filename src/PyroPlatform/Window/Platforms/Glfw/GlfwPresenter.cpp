@@ -0,0 +1,256 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "GlfwPresenter.hpp"
+#include "GlfwShared.hpp"
+#include <PyroCommon/Logger.hpp>
+#ifdef PYRO_PLATFORM_LINUX
+#define GLFW_EXPOSE_NATIVE_X11
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <bit>
+#include <cstring>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif
+#define GLFW_NATIVE_INCLUDE_NONE
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#ifdef PYRO_PLATFORM_LINUX
+#include <GLFW/glfw3native.h>
+#endif
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+#ifdef PYRO_PLATFORM_LINUX
+        namespace {
+            // MIT-SHM reports a failed attach asynchronously, as a protocol error
+            int gAttachError = 0;
+            int TrapAttachError(Display*, XErrorEvent* event) {
+                gAttachError = event->error_code;
+                return 0;
+            }
+            // XShmCreateImage keeps the segment info in obdata and XDestroyImage would free() it,
+            // but the info and the shared memory are ours to release
+            void DestroyShmImage(XImage* image) {
+                image->data = nullptr;
+                image->obdata = nullptr;
+                XDestroyImage(image);
+            }
+        } // namespace
+
+        GlfwPresenter::GlfwPresenter(GLFWwindow* window) {
+            if (glfwGetPlatform() != GLFW_PLATFORM_X11) {
+                Logger::Error(gGlfwSink, "Cannot present pixels! Reason: only implemented for X11");
+                return;
+            }
+            mDisplay = glfwGetX11Display();
+            mWindow = glfwGetX11Window(window);
+            XWindowAttributes attributes = {};
+            if (!mDisplay || !XGetWindowAttributes(mDisplay, mWindow, &attributes)) {
+                Logger::Error(gGlfwSink, "Cannot present pixels! Reason: failed to read the window attributes");
+                return;
+            }
+            mVisual = attributes.visual;
+            mDepth = static_cast<u32>(attributes.depth);
+            // the pixels are handed over as they are, the server has to store them the same way
+            int bitsPerPixel = 0;
+            int formatCount = 0;
+            if (XPixmapFormatValues* formats = XListPixmapFormats(mDisplay, &formatCount)) {
+                for (int i = 0; i < formatCount; ++i) {
+                    if (formats[i].depth == attributes.depth) {
+                        bitsPerPixel = formats[i].bits_per_pixel;
+                    }
+                }
+                XFree(formats);
+            }
+            const int byteOrder = std::endian::native == std::endian::little ? LSBFirst : MSBFirst;
+            bSupported = (mDepth == 24 || mDepth == 32) && bitsPerPixel == 32 && ImageByteOrder(mDisplay) == byteOrder;
+            if (!bSupported) {
+                Logger::Error(gGlfwSink, "Cannot present pixels! Reason: the window is {} bit with {} bits per pixel, only 32 bit pixels in native byte order are supported",
+                    mDepth, bitsPerPixel);
+                return;
+            }
+            mGc = XCreateGC(mDisplay, mWindow, 0, nullptr);
+            bUseShm = XShmQueryExtension(mDisplay);
+        }
+
+        GlfwPresenter::~GlfwPresenter() {
+            for (Segment& segment : mSegments) {
+                Release(segment);
+            }
+            if (mGc) {
+                XFreeGC(mDisplay, mGc);
+            }
+        }
+
+        bool GlfwPresenter::Present(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            if (!bSupported) {
+                return false;
+            }
+            const WindowRect whole = { 0, 0, size.width, size.height };
+            if (whole.IsEmpty()) {
+                return true;
+            }
+            const eastl::span<const WindowRect> rects = dirtyRects.empty() ? eastl::span<const WindowRect>(&whole, 1) : dirtyRects;
+            Segment* segment = bUseShm ? AcquireSegment(size) : nullptr;
+            if (!segment) {
+                // wraps the caller's pixels, XPutImage splits what doesn't fit in one request itself
+                XImage* image = XCreateImage(mDisplay, static_cast<Visual*>(mVisual), mDepth, ZPixmap, 0, const_cast<char*>(reinterpret_cast<const char*>(pixels.data())),
+                    size.width, size.height, 32, static_cast<int>(stride));
+                if (!image) {
+                    return false;
+                }
+                for (const WindowRect& dirty : rects) {
+                    const WindowRect rect = dirty.Clipped(size);
+                    if (!rect.IsEmpty()) {
+                        XPutImage(mDisplay, mWindow, mGc, image, rect.x, rect.y, rect.x, rect.y, rect.width, rect.height);
+                    }
+                }
+                // the pixels aren't ours to free
+                image->data = nullptr;
+                XDestroyImage(image);
+                XFlush(mDisplay);
+                return true;
+            }
+            XImage* image = segment->image;
+            for (const WindowRect& dirty : rects) {
+                const WindowRect rect = dirty.Clipped(size);
+                if (rect.IsEmpty()) {
+                    continue;
+                }
+                for (u32 row = 0; row < rect.height; ++row) {
+                    const usize y = static_cast<usize>(rect.y) + row;
+                    memcpy(image->data + y * image->bytes_per_line + static_cast<usize>(rect.x) * 4, &pixels[y * stride + static_cast<usize>(rect.x) * 4], rect.width * 4);
+                }
+                segment->serial = NextRequest(mDisplay);
+                segment->bBusy = true;
+                XShmPutImage(mDisplay, mWindow, mGc, image, rect.x, rect.y, rect.x, rect.y, rect.width, rect.height, False);
+            }
+            XFlush(mDisplay);
+            return true;
+        }
+
+        GlfwPresenter::Segment* GlfwPresenter::AcquireSegment(Size size) {
+            // GLFW reads the events, a completion would never reach us. The serial the server last
+            // answered tells just as well whether it is through with an image.
+            for (Segment& candidate : mSegments) {
+                if (candidate.bBusy && static_cast<i64>(LastKnownRequestProcessed(mDisplay) - candidate.serial) >= 0) {
+                    candidate.bBusy = false;
+                }
+            }
+            Segment* segment = nullptr;
+            for (u32 i = 0; i < 2 && !segment; ++i) {
+                Segment& candidate = mSegments[(mNextSegment + i) % 2];
+                if (!candidate.bBusy) {
+                    segment = &candidate;
+                    mNextSegment = (mNextSegment + i + 1) % 2;
+                }
+            }
+            if (!segment) {
+                // presenting faster than the server draws, wait until it is through both
+                XSync(mDisplay, False);
+                for (Segment& candidate : mSegments) {
+                    candidate.bBusy = false;
+                }
+                segment = &mSegments[mNextSegment];
+                mNextSegment = (mNextSegment + 1) % 2;
+            }
+            // a larger image is fine, only the part the size covers is uploaded
+            const bool bFits = segment->image && static_cast<u32>(segment->image->width) >= size.width && static_cast<u32>(segment->image->height) >= size.height;
+            if (!bFits && !Allocate(*segment, size)) {
+                Logger::Info(gGlfwSink, "MIT-SHM is not usable with this display, presenting through XPutImage");
+                for (Segment& candidate : mSegments) {
+                    Release(candidate);
+                }
+                bUseShm = false;
+                return nullptr;
+            }
+            return segment;
+        }
+
+        bool GlfwPresenter::Allocate(Segment& segment, Size size) {
+            Release(segment);
+            XShmSegmentInfo* info = new XShmSegmentInfo{};
+            XImage* image = XShmCreateImage(mDisplay, static_cast<Visual*>(mVisual), mDepth, ZPixmap, nullptr, info, size.width, size.height);
+            if (!image) {
+                delete info;
+                return false;
+            }
+            info->shmid = shmget(IPC_PRIVATE, static_cast<usize>(image->bytes_per_line) * image->height, IPC_CREAT | 0600);
+            info->shmaddr = info->shmid >= 0 ? static_cast<char*>(shmat(info->shmid, nullptr, 0)) : reinterpret_cast<char*>(-1);
+            if (info->shmaddr == reinterpret_cast<char*>(-1)) {
+                if (info->shmid >= 0) {
+                    shmctl(info->shmid, IPC_RMID, nullptr);
+                }
+                DestroyShmImage(image);
+                delete info;
+                return false;
+            }
+            image->data = info->shmaddr;
+            info->readOnly = True;
+            // a server on another machine can't attach, this is where that shows
+            XSync(mDisplay, False);
+            gAttachError = 0;
+            XErrorHandler previous = XSetErrorHandler(TrapAttachError);
+            const Bool bAttached = XShmAttach(mDisplay, info);
+            XSync(mDisplay, False);
+            XSetErrorHandler(previous);
+            // marked for removal right away, it goes once both sides detached, even after a crash
+            shmctl(info->shmid, IPC_RMID, nullptr);
+            if (!bAttached || gAttachError != 0) {
+                shmdt(info->shmaddr);
+                DestroyShmImage(image);
+                delete info;
+                return false;
+            }
+            segment.image = image;
+            segment.bBusy = false;
+            return true;
+        }
+
+        void GlfwPresenter::Release(Segment& segment) {
+            if (!segment.image) {
+                return;
+            }
+            XShmSegmentInfo* info = reinterpret_cast<XShmSegmentInfo*>(segment.image->obdata);
+            // the server detaches after the uploads before it, the memory stays valid for those
+            XShmDetach(mDisplay, info);
+            shmdt(info->shmaddr);
+            DestroyShmImage(segment.image);
+            delete info;
+            segment = {};
+        }
+#else
+        GlfwPresenter::GlfwPresenter(GLFWwindow* window) {
+            Logger::Error(gGlfwSink, "Cannot present pixels! Reason: only implemented for X11");
+        }
+
+        GlfwPresenter::~GlfwPresenter() = default;
+
+        bool GlfwPresenter::Present(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            return false;
+        }
+#endif
+    } // namespace Platform
+} // namespace PyroshockStudios
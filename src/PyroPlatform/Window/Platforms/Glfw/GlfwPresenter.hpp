@@ -0,0 +1,69 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/span.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+extern "C" struct GLFWwindow;
+extern "C" struct _XDisplay;
+extern "C" struct _XImage;
+extern "C" struct _XGC;
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Uploads CPU rendered pixels to a GLFW window on X11. With MIT-SHM the image is written to one
+        // of two shared memory images and the server reads it from there. A frame goes to the other one
+        // while the server may still read the last, an image is free again once the server processed
+        // the request that uploaded it. Remote displays fall back to XPutImage. Other platforms have
+        // no implementation yet.
+        class GlfwPresenter : DeleteCopy, DeleteMove {
+        public:
+            explicit GlfwPresenter(GLFWwindow* window);
+            ~GlfwPresenter();
+
+            bool Present(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects);
+
+        private:
+            struct Segment {
+                _XImage* image = nullptr;
+                // serial of the last XShmPutImage from this image
+                u64 serial = 0;
+                bool bBusy = false;
+            };
+
+            Segment* AcquireSegment(Size size);
+            bool Allocate(Segment& segment, Size size);
+            void Release(Segment& segment);
+
+            _XDisplay* mDisplay = nullptr;
+            _XGC* mGc = nullptr;
+            void* mVisual = nullptr;
+            u64 mWindow = 0;
+            u32 mDepth = 0;
+            Segment mSegments[2] = {};
+            u32 mNextSegment = 0;
+            bool bSupported = false;
+            bool bUseShm = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
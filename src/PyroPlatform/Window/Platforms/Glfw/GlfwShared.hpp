@@ -22,9 +22,20 @@
 
 #pragma once
 #include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Time/IClock.hpp>
 namespace PyroshockStudios {
     inline namespace Platform {
+        class InputEventStream;
         // implemented in GlfwWindowManager.cpp
         extern ILogStream* gGlfwSink;
+        // implemented in GlfwWindowManager.cpp, arrival counter shared by all windows
+        extern u64 gGlfwEventSequence;
+        // implemented in GlfwWindowManager.cpp, source of input event timestamps, may be null
+        extern IClock* gGlfwClock;
+        // implemented in GlfwWindowManager.cpp, every window also submits its records here
+        extern InputEventStream* gGlfwEventStream;
+        // implemented in GlfwWindowManager.cpp, set when monitor properties may have changed
+        extern bool gGlfwMonitorsDirty;
     } // namespace Platform
 } // namespace PyroshockStudios
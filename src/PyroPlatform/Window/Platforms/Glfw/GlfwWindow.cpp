@@ -25,6 +25,7 @@
 #include <PyroCommon/Logger.hpp>
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwCursor.hpp>
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwMonitor.hpp>
+#include <PyroPlatform/Window/Platforms/Glfw/GlfwPresenter.hpp>
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwWindowInput.hpp>
 #ifdef PYRO_PLATFORM_WINDOWS
 #include <Windows.h>
@@ -33,6 +34,7 @@
 
 #elif PYRO_PLATFORM_LINUX
 #define GLFW_EXPOSE_NATIVE_X11
+#include <X11/Xatom.h>
 #include <X11/Xlib.h>
 #include <X11/extensions/Xrandr.h>
 #elif PYRO_PLATFORM_MACOS
@@ -51,36 +53,65 @@
 
 namespace PyroshockStudios {
     inline namespace Platform {
+#ifdef PYRO_PLATFORM_LINUX
+        namespace {
+            // Window managers set _NET_WM_STATE_HIDDEN on windows that are on another virtual desktop.
+            // GLFW only looks at _NET_WM_STATE for maximizing, so it is read here through GLFW's display.
+            bool ReadNetWmHidden(GLFWwindow* window) {
+                if (glfwGetPlatform() != GLFW_PLATFORM_X11) {
+                    return false;
+                }
+                Display* display = glfwGetX11Display();
+                // Xlib caches interned atoms, only the first call goes to the server
+                const Atom netWmState = XInternAtom(display, "_NET_WM_STATE", False);
+                const Atom netWmStateHidden = XInternAtom(display, "_NET_WM_STATE_HIDDEN", False);
+                Atom type = None;
+                int format = 0;
+                unsigned long count = 0;
+                unsigned long remaining = 0;
+                unsigned char* data = nullptr;
+                if (XGetWindowProperty(display, glfwGetX11Window(window), netWmState, 0, 64, False, XA_ATOM,
+                        &type, &format, &count, &remaining, &data) != Success) {
+                    return false;
+                }
+                bool bHidden = false;
+                if (data != nullptr) {
+                    if (type == XA_ATOM && format == 32) {
+                        const Atom* states = reinterpret_cast<const Atom*>(data);
+                        for (unsigned long i = 0; i < count; ++i) {
+                            bHidden |= states[i] == netWmStateHidden;
+                        }
+                    }
+                    XFree(data);
+                }
+                return bHidden;
+            }
+        } // namespace
+#endif
+
         GlfwWindow::GlfwWindow(u32 width, u32 height, const char* title, GLFWmonitor* monitor, GLFWwindow* share)
             : mWindow(glfwCreateWindow(width, height, title, monitor, share)) {
             // APPARENTLY in GCC fields dont get assigned until the constructor finished creating the members on top????? WHAT IS THIS
             glfwSetWindowUserPointer(mWindow, this);
             mInput = new GlfwWindowInput(this);
-            glfwSetWindowRefreshCallback(mWindow, [](GLFWwindow* window) {
-                GlfwWindow* self = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            });
+            Refresh();
         }
         GlfwWindow::~GlfwWindow() {
+            delete mPresenter;
             delete mInput;
             glfwDestroyWindow(mWindow);
         }
 
         Size GlfwWindow::GetSize() const {
-            int x, y;
-            glfwGetWindowSize(mWindow, &x, &y);
-            return Size(x, y);
+            return mCache.size;
         }
 
         Point GlfwWindow::GetPosition() const {
-            int x, y;
-            glfwGetWindowPos(mWindow, &x, &y);
-            return Point(x, y);
+            return mCache.position;
         }
 
         Point GlfwWindow::GetCursorPosition() const {
-            double x, y;
-            glfwGetCursorPos(mWindow, &x, &y);
-            return Point(static_cast<u32>(x), static_cast<u32>(y));
+            return mCache.cursorPosition;
         }
 
         f32 GlfwWindow::GetOpacity() const {
@@ -150,9 +181,9 @@ namespace PyroshockStudios {
         }
 
         WindowState GlfwWindow::GetWindowState() const {
-            if (glfwGetWindowAttrib(mWindow, GLFW_ICONIFIED))
+            if (mCache.bIconified)
                 return WindowState::Minimized;
-            if (glfwGetWindowAttrib(mWindow, GLFW_MAXIMIZED))
+            if (mCache.bMaximized)
                 return WindowState::Maximized;
             return WindowState::Normal;
         }
@@ -167,23 +198,19 @@ namespace PyroshockStudios {
         }
 
         Size GlfwWindow::GetFramebufferSize() const {
-            int width, height;
-            glfwGetFramebufferSize(mWindow, &width, &height);
-            return Size(width, height);
+            return mCache.framebufferSize;
         }
 
         f32 GlfwWindow::GetDPIScale() const {
-            int fbWidth, fbHeight;
-            int winWidth, winHeight;
-            glfwGetFramebufferSize(mWindow, &fbWidth, &fbHeight);
-            glfwGetWindowSize(mWindow, &winWidth, &winHeight);
-            return static_cast<f32>(fbWidth) / static_cast<f32>(winWidth);
+            if (mCache.size.width == 0) {
+                // minimised on some platforms, there is nothing to compare against
+                return 1.0f;
+            }
+            return static_cast<f32>(mCache.framebufferSize.width) / static_cast<f32>(mCache.size.width);
         }
 
         FSize GlfwWindow::GetContentScale() const {
-            float x, y;
-            glfwGetWindowContentScale(mWindow, &x, &y);
-            return FSize(x, y);
+            return mCache.contentScale;
         }
 
         CursorMode GlfwWindow::GetCursorMode() const {
@@ -242,10 +269,14 @@ namespace PyroshockStudios {
 
         void GlfwWindow::Show() {
             glfwShowWindow(mWindow);
+            mCache.bVisible = true;
+            mInput->UpdateVisibility();
         }
 
         void GlfwWindow::Hide() {
             glfwHideWindow(mWindow);
+            mCache.bVisible = false;
+            mInput->UpdateVisibility();
         }
 
         void GlfwWindow::Close() {
@@ -281,17 +312,72 @@ namespace PyroshockStudios {
         }
 
         bool GlfwWindow::IsFocused() const {
-            return glfwGetWindowAttrib(mWindow, GLFW_FOCUSED) != 0;
+            return mCache.bFocused;
         }
 
         bool GlfwWindow::IsHovered() const {
-            return glfwGetWindowAttrib(mWindow, GLFW_HOVERED) != 0;
+            return mCache.bHovered;
+        }
+
+        WindowVisibilityState GlfwWindow::GetVisibilityState() const {
+            return mCache.visibility;
+        }
+
+        WindowVisibilityState GlfwWindow::ComputeVisibility() const {
+            if (mCache.bIconified) {
+                return WindowVisibilityState::Iconified;
+            }
+            return mCache.bVisible && !mCache.bHidden ? WindowVisibilityState::Visible : WindowVisibilityState::FullyObscured;
+        }
+
+        void GlfwWindow::UpdateHidden() {
+#ifdef PYRO_PLATFORM_LINUX
+            const bool bHidden = ReadNetWmHidden(mWindow);
+            if (bHidden != mCache.bHidden) {
+                mCache.bHidden = bHidden;
+                mInput->UpdateVisibility();
+            }
+#endif
+        }
+
+        void GlfwWindow::Refresh() {
+            int x, y;
+            glfwGetWindowSize(mWindow, &x, &y);
+            mCache.size = Size(x, y);
+            glfwGetFramebufferSize(mWindow, &x, &y);
+            mCache.framebufferSize = Size(x, y);
+            glfwGetWindowPos(mWindow, &x, &y);
+            mCache.position = Point(x, y);
+            double cursorX, cursorY;
+            glfwGetCursorPos(mWindow, &cursorX, &cursorY);
+            mCache.cursorPosition = ToCursorPoint(cursorX, cursorY);
+            float scaleX, scaleY;
+            glfwGetWindowContentScale(mWindow, &scaleX, &scaleY);
+            mCache.contentScale = FSize(scaleX, scaleY);
+            mCache.bFocused = glfwGetWindowAttrib(mWindow, GLFW_FOCUSED) != 0;
+            mCache.bHovered = glfwGetWindowAttrib(mWindow, GLFW_HOVERED) != 0;
+            mCache.bVisible = glfwGetWindowAttrib(mWindow, GLFW_VISIBLE) != 0;
+            mCache.bIconified = glfwGetWindowAttrib(mWindow, GLFW_ICONIFIED) != 0;
+            mCache.bMaximized = glfwGetWindowAttrib(mWindow, GLFW_MAXIMIZED) != 0;
+#ifdef PYRO_PLATFORM_LINUX
+            mCache.bHidden = ReadNetWmHidden(mWindow);
+#endif
+            mCache.visibility = ComputeVisibility();
         }
 
         IWindowInput* GlfwWindow::GetInputHandler() {
             return mInput;
         }
 
+        bool GlfwWindow::PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            ASSERT(stride >= size.width * 4, "Stride is shorter than a row!");
+            ASSERT(size.height == 0 || pixels.size() >= static_cast<usize>(stride) * (size.height - 1) + size.width * 4, "Pixel buffer is smaller than the image!");
+            if (!mPresenter) {
+                mPresenter = new GlfwPresenter(mWindow);
+            }
+            return mPresenter->Present(pixels, size, stride, dirtyRects);
+        }
+
 
 #ifndef PYRO_PLATFORM_MACOS // Macos headers have objective c includes, those are in GlfwWindow.mm
         NativeHandle GlfwWindow::GetNativeWindow() const {
@@ -30,6 +30,7 @@ namespace PyroshockStudios {
     inline namespace Platform {
         class GlfwWindowManager;
         class GlfwWindowInput;
+        class GlfwPresenter;
         class GlfwWindow : public IWindow, DeleteCopy, DeleteMove {
         public:
             GlfwWindow(u32 width, u32 height, const char* title, GLFWmonitor* monitor, GLFWwindow* share);
@@ -74,18 +75,54 @@ namespace PyroshockStudios {
             bool ShouldClose() const override;
             bool IsFocused() const override;
             bool IsHovered() const override;
+            // GLFW reports no occlusion by other windows. A shown window that is not iconified is Visible,
+            // unless on X11 the window manager marked it hidden, see UpdateHidden().
+            WindowVisibilityState GetVisibilityState() const override;
+
+            void Refresh() override;
 
             IWindowInput* GetInputHandler() override;
 
+            // MIT-SHM when the X server is local, XPutImage otherwise. X11 only.
+            bool PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects = {}) override;
+
             NativeHandle GetNativeWindow() const override;
             NativeHandle GetNativeInstance() const override;
 
             GLFWwindow* GetGLFWWindow() const {
                 return mWindow;
             }
+            // Re-reads _NET_WM_STATE_HIDDEN on X11, a server round trip. GLFW has no event for it,
+            // so the window manager calls this every so often from its poll.
+            void UpdateHidden();
 
         private:
+            friend class GlfwWindowInput;
+
+            WindowVisibilityState ComputeVisibility() const;
+
+            // Last known window properties, updated by the window callbacks in GlfwWindowInput.
+            // Several of the matching GLFW queries are server round trips on X11.
+            struct PropertyCache {
+                Size size = {};
+                Size framebufferSize = {};
+                Point position = {};
+                Point cursorPosition = {};
+                FSize contentScale = {};
+                bool bFocused = false;
+                bool bHovered = false;
+                bool bVisible = false;
+                bool bIconified = false;
+                bool bMaximized = false;
+                // _NET_WM_STATE_HIDDEN, e.g. on another virtual desktop
+                bool bHidden = false;
+                WindowVisibilityState visibility = WindowVisibilityState::FullyObscured;
+            };
+
+            PropertyCache mCache = {};
             GlfwWindowInput* mInput = nullptr;
+            // created by the first PresentPixels()
+            GlfwPresenter* mPresenter = nullptr;
             GLFWwindow* mWindow = nullptr;
         };
     } // namespace Platform
@@ -21,9 +21,11 @@
 // SOFTWARE.
 
 #include "GlfwWindowInput.hpp"
+#include "GlfwShared.hpp"
 #define GLFW_NATIVE_INCLUDE_NONE
 #define GLFW_INCLUDE_NONE
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwWindow.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
 #include <PyroPlatform/Window/WindowEvents.hpp>
 
 #include <GLFW/glfw3.h>
@@ -33,20 +35,66 @@ namespace PyroshockStudios {
         GlfwWindowInput::GlfwWindowInput(GlfwWindow* window) : mWindow(window) {
             CreateCallbacks();
             mEvents = new WindowEvents;
+            mEvents->SetClock(gGlfwClock);
         }
         GlfwWindowInput::~GlfwWindowInput() {
             delete mEvents;
         }
         bool GlfwWindowInput::IsKeyDown(KeyCode key) {
-            return glfwGetKey(mWindow->GetGLFWWindow(), static_cast<int>(key)) == GLFW_PRESS;
+            return mPublished.IsKeyDown(key);
         }
 
         bool GlfwWindowInput::IsMouseDown(MouseButton button) {
-            return glfwGetMouseButton(mWindow->GetGLFWWindow(), static_cast<int>(button)) == GLFW_PRESS;
+            return mPublished.IsMouseDown(button);
+        }
+        bool GlfwWindowInput::WasPressed(KeyCode key) const {
+            return mPublished.WasPressed(key);
+        }
+        bool GlfwWindowInput::WasReleased(KeyCode key) const {
+            return mPublished.WasReleased(key);
+        }
+        bool GlfwWindowInput::WasPressed(MouseButton button) const {
+            return mPublished.WasPressed(button);
+        }
+        bool GlfwWindowInput::WasReleased(MouseButton button) const {
+            return mPublished.WasReleased(button);
+        }
+        InputSnapshot GlfwWindowInput::GetSnapshot() const {
+            return mShared.Load();
+        }
+        void GlfwWindowInput::PublishSnapshot() {
+            mPublished = mState;
+            mShared.Store(mPublished);
+            mState.ClearFrame();
         }
         WindowEvents& GlfwWindowInput::GetEvents() {
             return *mEvents;
         }
+        void GlfwWindowInput::SetBufferedEvents(bool bEnabled) {
+            if (!bEnabled) {
+                // don't lose what was recorded while buffering was on
+                DrainEvents();
+            }
+            bBuffered = bEnabled;
+        }
+        bool GlfwWindowInput::IsBufferedEvents() const {
+            return bBuffered;
+        }
+        void GlfwWindowInput::DrainEvents() {
+            while (!mQueue.Empty()) {
+                // copy out first, handlers may cause new events to be queued
+                const InputEventRecord record = mQueue.Front();
+                mQueue.Pop();
+                mEvents->Dispatch(*mWindow, record);
+            }
+            mEvents->FlushText();
+        }
+        void GlfwWindowInput::SetEventCoalescing(InputEventType type, bool bEnabled) {
+            mQueue.SetCoalescing(type, bEnabled);
+        }
+        u64 GlfwWindowInput::GetCoalescedCount(InputEventType type) const {
+            return mQueue.GetMergedCount(type);
+        }
         void GlfwWindowInput::CreateCallbacks() {
             glfwSetKeyCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::KeyCallback);
             glfwSetCursorEnterCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::CursorEnterCallback);
@@ -58,72 +106,121 @@ namespace PyroshockStudios {
             glfwSetWindowFocusCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::FocusCallback);
             glfwSetWindowCloseCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::CloseCallback);
             glfwSetWindowPosCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::PositionCallback);
+            glfwSetFramebufferSizeCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::FramebufferSizeCallback);
+            glfwSetWindowContentScaleCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::ContentScaleCallback);
+            glfwSetWindowIconifyCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::IconifyCallback);
+            glfwSetWindowMaximizeCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::MaximizeCallback);
+            glfwSetWindowRefreshCallback(mWindow->GetGLFWWindow(), GlfwWindowInput::RefreshCallback);
         }
 
-        void GlfwWindowInput::KeyCallback(GLFWwindow* window, int key, int scanCode, int action, int mods) {
+        GlfwWindowInput* GlfwWindowInput::GetInput(GLFWwindow* window) {
             GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            KeyEvent event = KeyEvent(*pThis, static_cast<KeyCode>(key), scanCode, static_cast<InputModifiers::Flags>(mods),
-                action == GLFW_PRESS || action == GLFW_REPEAT, action == GLFW_REPEAT);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<KeyEvent>().Dispatch(event);
+            return static_cast<GlfwWindowInput*>(pThis->GetInputHandler());
+        }
+        void GlfwWindowInput::Submit(InputEventRecord record) {
+            // every callback submits straight away, so this is as close to callback entry as it gets
+            record.timestamp = gGlfwClock ? gGlfwClock->GetTicks() : 0;
+            record.sequence = gGlfwEventSequence++;
+            mState.Apply(record);
+            if (gGlfwEventStream) {
+                gGlfwEventStream->Push(*mWindow, record);
+            }
+            if (bBuffered) {
+                mQueue.Push(record);
+            } else {
+                mEvents->Dispatch(*mWindow, record);
+            }
+        }
+
+        void GlfwWindowInput::UpdateVisibility() {
+            const WindowVisibilityState visibility = mWindow->ComputeVisibility();
+            if (visibility == mWindow->mCache.visibility) {
+                return;
+            }
+            mWindow->mCache.visibility = visibility;
+            Submit(InputEventRecord::WindowVisibility(visibility));
+        }
+
+        void GlfwWindowInput::KeyCallback(GLFWwindow* window, int key, int scanCode, int action, int mods) {
+            GetInput(window)->Submit(InputEventRecord::Key(static_cast<KeyCode>(key), scanCode, static_cast<InputModifiers::Flags>(mods),
+                action == GLFW_PRESS || action == GLFW_REPEAT, action == GLFW_REPEAT));
         }
+        // The window property cache is updated before submitting, so handlers already see the new values
         void GlfwWindowInput::CursorEnterCallback(GLFWwindow* window, int entered) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            CursorEnterEvent event = CursorEnterEvent(*pThis, entered != 0);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<CursorEnterEvent>().Dispatch(event);
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.bHovered = entered != 0;
+            if (entered) {
+                input->bCursorTracked = false;
+            }
+            input->Submit(InputEventRecord::CursorEnter(entered != 0));
         }
         void GlfwWindowInput::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            MouseEvent event = MouseEvent(*pThis, static_cast<MouseButton>(button),
-                static_cast<InputModifiers::Flags>(mods), action == GLFW_PRESS);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<MouseEvent>().Dispatch(event);
+            GetInput(window)->Submit(InputEventRecord::Mouse(static_cast<MouseButton>(button),
+                static_cast<InputModifiers::Flags>(mods), action == GLFW_PRESS));
         }
         void GlfwWindowInput::MouseScrollCallback(GLFWwindow* window, double x, double y) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            CursorScrollEvent event = CursorScrollEvent(*pThis, static_cast<float>(x),
-                static_cast<float>(y));
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<CursorScrollEvent>().Dispatch(event);
+            GetInput(window)->Submit(InputEventRecord::CursorScroll(static_cast<f64>(x), static_cast<f64>(y)));
         }
         void GlfwWindowInput::MousePositionCallback(GLFWwindow* window, double x, double y) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            CursorPositionEvent event = CursorPositionEvent(*pThis, static_cast<float>(x),
-                static_cast<float>(y));
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<CursorPositionEvent>().Dispatch(event);
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.cursorPosition = ToCursorPoint(x, y);
+            const InputSnapshot& state = input->mState;
+            // the first motion has nothing to be relative to, it would report the absolute position as the delta
+            const f64 deltaX = input->bCursorTracked ? static_cast<f64>(x) - state.cursorX : 0.0;
+            const f64 deltaY = input->bCursorTracked ? static_cast<f64>(y) - state.cursorY : 0.0;
+            input->bCursorTracked = true;
+            input->Submit(InputEventRecord::CursorPosition(static_cast<f64>(x), static_cast<f64>(y), deltaX, deltaY));
         }
         void GlfwWindowInput::CharCallback(GLFWwindow* window, unsigned int codePoint) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            CharInputEvent event = CharInputEvent(*pThis, codePoint);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<CharInputEvent>().Dispatch(event);
+            GetInput(window)->Submit(InputEventRecord::CharInput(codePoint));
         }
         void GlfwWindowInput::ResizeCallback(GLFWwindow* window, int width, int height) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            WindowResizeEvent event = WindowResizeEvent(*pThis, width, height);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<WindowResizeEvent>().Dispatch(event);
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.size = Size(width, height);
+            input->Submit(InputEventRecord::WindowResize(static_cast<u32>(width), static_cast<u32>(height)));
         }
 
         void GlfwWindowInput::FocusCallback(GLFWwindow* window, int focussed) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            WindowFocusEvent event = WindowFocusEvent(*pThis, focussed != 0);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<WindowFocusEvent>().Dispatch(event);
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.bFocused = focussed != 0;
+            input->Submit(InputEventRecord::WindowFocus(focussed != 0));
         }
         void GlfwWindowInput::CloseCallback(GLFWwindow* window) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            WindowCloseEvent event = WindowCloseEvent(*pThis);
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<WindowCloseEvent>().Dispatch(event);
+            GetInput(window)->Submit(InputEventRecord::WindowClose());
         }
         void GlfwWindowInput::PositionCallback(GLFWwindow* window, int x, int y) {
-            GlfwWindow* pThis = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
-            WindowPositionEvent event = WindowPositionEvent(*pThis, static_cast<f64>(x), static_cast<f64>(y));
-            WindowEvents& events = pThis->GetInputHandler()->GetEvents();
-            events.GetEventDispatcher<WindowPositionEvent>().Dispatch(event);
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.position = Point(x, y);
+            input->Submit(InputEventRecord::WindowPosition(static_cast<f64>(x), static_cast<f64>(y)));
+        }
+        void GlfwWindowInput::FramebufferSizeCallback(GLFWwindow* window, int width, int height) {
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.framebufferSize = Size(width, height);
+            input->Submit(InputEventRecord::WindowFramebufferResize(static_cast<u32>(width), static_cast<u32>(height)));
+        }
+        void GlfwWindowInput::ContentScaleCallback(GLFWwindow* window, float x, float y) {
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.contentScale = FSize(x, y);
+            // usually the monitor scale changed, or the window moved to another monitor
+            gGlfwMonitorsDirty = true;
+            input->Submit(InputEventRecord::WindowContentScale(static_cast<f64>(x), static_cast<f64>(y)));
+        }
+        void GlfwWindowInput::IconifyCallback(GLFWwindow* window, int iconified) {
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.bIconified = iconified != 0;
+            input->Submit(InputEventRecord::WindowIconify(iconified != 0));
+            input->UpdateVisibility();
+        }
+        void GlfwWindowInput::MaximizeCallback(GLFWwindow* window, int maximized) {
+            GlfwWindowInput* input = GetInput(window);
+            input->mWindow->mCache.bMaximized = maximized != 0;
+            input->Submit(InputEventRecord::WindowMaximize(maximized != 0));
+        }
+        void GlfwWindowInput::RefreshCallback(GLFWwindow* window) {
+            GlfwWindowInput* input = GetInput(window);
+            // GLFW doesn't pass on which part was damaged, all of it has to be drawn again
+            const Size framebuffer = input->mWindow->mCache.framebufferSize;
+            input->Submit(InputEventRecord::WindowExpose(0, 0, framebuffer.width, framebuffer.height));
         }
     }
 }
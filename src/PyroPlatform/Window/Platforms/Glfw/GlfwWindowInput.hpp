@@ -24,6 +24,8 @@
 #include <PyroCommon/Core.hpp>
 #include <PyroPlatform/Forward.hpp>
 #include <PyroPlatform/Window/IWindowInput.hpp>
+#include <PyroPlatform/Window/Input/InputEventQueue.hpp>
+#include <PyroPlatform/Window/Input/InputSnapshot.hpp>
 #ifdef PYRO_PLATFORM_WINDOWING_GLFW
 
 extern "C" struct GLFWwindow;
@@ -39,11 +41,37 @@ namespace PyroshockStudios {
 
             bool IsKeyDown(KeyCode key) override;
             bool IsMouseDown(MouseButton button) override;
+            bool WasPressed(KeyCode key) const override;
+            bool WasReleased(KeyCode key) const override;
+            bool WasPressed(MouseButton button) const override;
+            bool WasReleased(MouseButton button) const override;
+            InputSnapshot GetSnapshot() const override;
+            void PublishSnapshot() override;
 
             WindowEvents& GetEvents() override;
 
+            void SetBufferedEvents(bool bBuffered) override;
+            bool IsBufferedEvents() const override;
+            void DrainEvents() override;
+            void SetEventCoalescing(InputEventType type, bool bEnabled) override;
+            u64 GetCoalescedCount(InputEventType type) const override;
+
+            InputEventQueue& GetEventQueue() {
+                return mQueue;
+            }
+            GlfwWindow* GetWindow() const {
+                return mWindow;
+            }
+
         private:
+            friend class GlfwWindow;
+
             void CreateCallbacks();
+            // Buffers the record, or dispatches it right away when buffering is off
+            void Submit(InputEventRecord record);
+            // Submits a WindowVisibility record when the window's visibility changed
+            void UpdateVisibility();
+            static GlfwWindowInput* GetInput(GLFWwindow* window);
 
             static void KeyCallback(GLFWwindow* window, int key, int scanCode, int action, int mods);
             static void CursorEnterCallback(GLFWwindow* window, int entered);
@@ -55,9 +83,24 @@ namespace PyroshockStudios {
             static void FocusCallback(GLFWwindow* window, int focussed);
             static void CloseCallback(GLFWwindow* window);
             static void PositionCallback(GLFWwindow* window, int x, int y);
+            static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
+            static void ContentScaleCallback(GLFWwindow* window, float x, float y);
+            static void IconifyCallback(GLFWwindow* window, int iconified);
+            static void MaximizeCallback(GLFWwindow* window, int maximized);
+            static void RefreshCallback(GLFWwindow* window);
 
             GlfwWindow* mWindow = nullptr;
             WindowEvents* mEvents = nullptr;
+            InputEventQueue mQueue = {};
+            // live state follows events as they arrive, the published copy is what queries see
+            InputSnapshot mState = {};
+            InputSnapshot mPublished = {};
+            // the published copy again, for GetSnapshot() from other threads
+            InputSnapshotBuffer mShared;
+            bool bBuffered = false;
+            // whether mState holds a real cursor position to take motion deltas from,
+            // cleared again when the cursor enters since it moved while outside
+            bool bCursorTracked = false;
         };
     }
 }
@@ -22,8 +22,12 @@
 
 #include "GlfwWindowManager.hpp"
 #include <PyroCommon/Logger.hpp>
+#include <PyroPlatform/Factory.hpp>
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwCursor.hpp>
 #include <PyroPlatform/Window/Platforms/Glfw/GlfwWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Glfw/GlfwWindowInput.hpp>
+#include <PyroPlatform/Window/MonitorEvent.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
 
 #define GLFW_NATIVE_INCLUDE_NONE
 #define GLFW_INCLUDE_NONE
@@ -34,12 +38,31 @@
 namespace PyroshockStudios {
     inline namespace Platform {
         ILogStream* gGlfwSink = nullptr;
+        u64 gGlfwEventSequence = 0;
+        IClock* gGlfwClock = nullptr;
+        InputEventStream* gGlfwEventStream = nullptr;
+        bool gGlfwMonitorsDirty = false;
+
+        namespace {
+            // the GLFW monitor callback has no user pointer of its own
+            GlfwWindowManager* gMonitorListener = nullptr;
+        } // namespace
 
         bool GlfwWindowManager::Init() {
             mMonitors.clear();
             mMonitorsStorage.clear();
+#ifdef PYRO_PLATFORM_TIME
+            if (gGlfwClock == nullptr) {
+                gGlfwClock = PlatformFactory::Get<IClock>();
+            }
+#endif
+            // hats are read separately, as buttons they would shift the indices SDL mappings refer to
+            glfwInitHint(GLFW_JOYSTICK_HAT_BUTTONS, GLFW_FALSE);
             bool result = glfwInit();
             if (result) {
+                gGlfwEventStream = &mEventStream;
+                gMonitorListener = this;
+                mEventStream.GetEvents().SetClock(gGlfwClock);
                 // disable legacy OpenGL functionality
                 glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
                 // force X11 on linux
@@ -50,7 +73,7 @@ namespace PyroshockStudios {
                     if (event == GLFW_CONNECTED) {
                         GlfwWindowManager::MonitorConnectedCallback(monitor);
                     } else if (event == GLFW_DISCONNECTED) {
-                        GlfwWindowManager::MonitorConnectedCallback(monitor);
+                        GlfwWindowManager::MonitorDisconnectedCallback(monitor);
                     }
                 });
                 int count = 0;
@@ -73,9 +96,12 @@ namespace PyroshockStudios {
 
         bool GlfwWindowManager::Terminate() {
             Logger::Trace(gGlfwSink, "Terminating GLFW");
-            glfwTerminate();
+            // monitors reset their GLFW user pointer, so they go before GLFW does
             mMonitors.clear();
             mMonitorsStorage.clear();
+            glfwTerminate();
+            gGlfwEventStream = nullptr;
+            gMonitorListener = nullptr;
             bInitialised = false;
             return true;
         }
@@ -83,10 +109,69 @@ namespace PyroshockStudios {
         void GlfwWindowManager::PollEvents() {
             ASSERT(bInitialised, "Window manager not initialised!");
             glfwPollEvents();
+            FinishPoll();
+            mGamepadInput.Poll();
         }
         void GlfwWindowManager::WaitEvents() {
             ASSERT(bInitialised, "Window manager not initialised!");
             glfwWaitEvents();
+            FinishPoll();
+            mGamepadInput.Poll();
+        }
+        void GlfwWindowManager::DrainEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            // merge the per-window queues by arrival order, there are only ever a handful of windows
+            for (;;) {
+                GlfwWindowInput* next = nullptr;
+                for (GlfwWindow* window : mWindows) {
+                    auto* input = static_cast<GlfwWindowInput*>(window->GetInputHandler());
+                    InputEventQueue& queue = input->GetEventQueue();
+                    if (queue.Empty()) {
+                        continue;
+                    }
+                    if (!next || queue.Front().sequence < next->GetEventQueue().Front().sequence) {
+                        next = input;
+                    }
+                }
+                if (!next) {
+                    break;
+                }
+                const InputEventRecord record = next->GetEventQueue().Front();
+                next->GetEventQueue().Pop();
+                next->GetEvents().Dispatch(*next->GetWindow(), record);
+            }
+            for (GlfwWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().FlushText();
+            }
+        }
+        void GlfwWindowManager::InjectClock(IClock* clock) {
+            gGlfwClock = clock;
+            mEventStream.GetEvents().SetClock(clock);
+            for (GlfwWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().SetClock(clock);
+            }
+        }
+        WindowEvents& GlfwWindowManager::GetEvents() {
+            return mEventStream.GetEvents();
+        }
+        void GlfwWindowManager::FinishPoll() {
+            const f64 now = glfwGetTime();
+            if (now >= mNextHiddenCheck) {
+                mNextHiddenCheck = now + kHiddenStateInterval;
+                for (GlfwWindow* window : mWindows) {
+                    window->UpdateHidden();
+                }
+            }
+            for (GlfwWindow* window : mWindows) {
+                IWindowInput* input = window->GetInputHandler();
+                // text typed during this poll goes out as one run, buffered windows do this on drain
+                input->GetEvents().FlushText();
+                input->PublishSnapshot();
+            }
+            mEventStream.Dispatch();
+            if (gGlfwMonitorsDirty) {
+                RefreshMonitors();
+            }
         }
 
         bool GlfwWindowManager::HasClipboardText() {
@@ -122,6 +207,48 @@ namespace PyroshockStudios {
             Logger::Error(gGlfwSink, "No monitor was found! Reason: {}", err);
             return nullptr;
         }
+        IMonitor* GlfwWindowManager::GetMonitorForWindow(IWindow* window) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            ASSERT(dynamic_cast<GlfwWindow*>(window) != nullptr, "Type must be of GlfwWindow!");
+            if (GLFWmonitor* fullscreen = glfwGetWindowMonitor(static_cast<GlfwWindow*>(window)->GetGLFWWindow())) {
+                return GlfwMonitor::Get(fullscreen);
+            }
+            const Point position = window->GetPosition();
+            const Size size = window->GetSize();
+            const i64 left = static_cast<i32>(position.x);
+            const i64 top = static_cast<i32>(position.y);
+            const i64 right = left + size.width;
+            const i64 bottom = top + size.height;
+
+            IMonitor* best = nullptr;
+            i64 bestArea = 0;
+            for (IMonitor* monitor : mMonitors) {
+                const Point monitorPosition = monitor->GetPosition();
+                const Size resolution = monitor->GetResolution();
+                const i64 monitorLeft = static_cast<i32>(monitorPosition.x);
+                const i64 monitorTop = static_cast<i32>(monitorPosition.y);
+                const i64 width = eastl::min(right, monitorLeft + resolution.width) - eastl::max(left, monitorLeft);
+                const i64 height = eastl::min(bottom, monitorTop + resolution.height) - eastl::max(top, monitorTop);
+                if (width > 0 && height > 0 && width * height > bestArea) {
+                    best = monitor;
+                    bestArea = width * height;
+                }
+            }
+            return best;
+        }
+        void GlfwWindowManager::RefreshMonitors() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            gGlfwMonitorsDirty = false;
+            for (IMonitor* monitor : mMonitors) {
+                if (static_cast<GlfwMonitor*>(monitor)->Refresh()) {
+                    MonitorEvent event(*monitor, MonitorEventType::Changed);
+                    mEventStream.GetEvents().Emit(event);
+                }
+            }
+        }
+        IGamepadInput* GlfwWindowManager::GetGamepadInput() {
+            return &mGamepadInput;
+        }
 
         IWindow* GlfwWindowManager::CreateWindow(const WindowInfo& info) {
             ASSERT(bInitialised, "Window manager not initialised!");
@@ -135,7 +262,9 @@ namespace PyroshockStudios {
             glfwWindowHint(GLFW_SCALE_TO_MONITOR, info.flags & WindowCreateBits::HIGH_DPI ? GLFW_TRUE : GLFW_FALSE);
 
             Logger::Trace(gGlfwSink, "Creating window \"{}\" with size {}x{}", info.title, info.width, info.height);
-            return new GlfwWindow(info.width, info.height, info.title.c_str(), nullptr, nullptr);
+            GlfwWindow* window = new GlfwWindow(info.width, info.height, info.title.c_str(), nullptr, nullptr);
+            mWindows.push_back(window);
+            return window;
         }
 
         void GlfwWindowManager::DestroyWindow(IWindow*& window) {
@@ -143,6 +272,8 @@ namespace PyroshockStudios {
             ASSERT(dynamic_cast<GlfwWindow*>(window) != nullptr, "Type must be of GlfwWindow!");
             Logger::Trace(gGlfwSink, "Destroying window \"{}\"", window->GetTitle());
             GlfwWindow* wnd = static_cast<GlfwWindow*>(window);
+            mWindows.erase(eastl::remove(mWindows.begin(), mWindows.end(), wnd), mWindows.end());
+            mEventStream.Remove(window);
             delete wnd;
             window = nullptr;
         }
@@ -256,25 +387,38 @@ namespace PyroshockStudios {
 
         void GlfwWindowManager::MonitorConnectedCallback(GLFWmonitor* monitor) {
             const char* name = glfwGetMonitorName(monitor);
-            Logger::Error(gGlfwSink, "Monitor \"{}\" connected", name ? name : "NAME_ERROR");
-            auto* self = reinterpret_cast<GlfwWindowManager*>(glfwGetMonitorUserPointer(monitor));
+            Logger::Info(gGlfwSink, "Monitor \"{}\" connected", name ? name : "NAME_ERROR");
+            GlfwWindowManager* self = gMonitorListener;
+            if (!self) {
+                return;
+            }
             self->mMonitorsStorage.emplace_back(eastl::make_shared<GlfwMonitor>(monitor));
             self->mMonitors.push_back(self->mMonitorsStorage.back().get());
+            MonitorEvent event(*self->mMonitors.back(), MonitorEventType::Connected);
+            self->mEventStream.GetEvents().Emit(event);
+            // the others may have been rearranged around it
+            gGlfwMonitorsDirty = true;
         }
 
         void GlfwWindowManager::MonitorDisconnectedCallback(GLFWmonitor* monitor) {
             const char* name = glfwGetMonitorName(monitor);
-            Logger::Error(gGlfwSink, "Monitor \"{}\" disconnected", name ? name : "NAME_ERROR");
-            auto* self = reinterpret_cast<GlfwWindowManager*>(glfwGetMonitorUserPointer(monitor));
+            Logger::Info(gGlfwSink, "Monitor \"{}\" disconnected", name ? name : "NAME_ERROR");
+            GlfwWindowManager* self = gMonitorListener;
+            if (!self) {
+                return;
+            }
             auto it = eastl::find_if(self->mMonitorsStorage.begin(), self->mMonitorsStorage.end(),
                 [monitor](const eastl::shared_ptr<GlfwMonitor>& m) { return m->GetGLFWMonitor() == monitor; });
 
             if (it != self->mMonitorsStorage.end()) {
+                MonitorEvent event(**it, MonitorEventType::Disconnected);
+                self->mEventStream.GetEvents().Emit(event);
                 // Remove pointer from mMonitors
                 self->mMonitors.erase(eastl::remove(self->mMonitors.begin(), self->mMonitors.end(), static_cast<IMonitor*>(it->get())));
                 // Remove storage
                 self->mMonitorsStorage.erase(it);
             }
+            gGlfwMonitorsDirty = true;
         }
 
     } // namespace Platform
@@ -24,14 +24,18 @@
 #include <EASTL/string.h>
 #include <EASTL/vector.h>
 
+#include "GlfwGamepadSource.hpp"
 #include "GlfwMonitor.hpp"
 #include <EASTL/shared_ptr.h>
 #include <PyroCommon/Core.hpp>
 #include <PyroPlatform/Forward.hpp>
 #include <PyroPlatform/Window/IWindowManager.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/Input/GamepadInput.hpp>
 
 namespace PyroshockStudios {
     inline namespace Platform {
+        class GlfwWindow;
         class GlfwWindowManager : public IWindowManager, DeleteCopy, DeleteMove {
         public:
             bool Init() override;
@@ -39,12 +43,18 @@ namespace PyroshockStudios {
 
             void PollEvents() override;
             void WaitEvents() override;
+            void DrainEvents() override;
+            void InjectClock(IClock* clock) override;
+            WindowEvents& GetEvents() override;
 
             bool HasClipboardText() override;
             eastl::string GetClipboardText() override;
             void SetClipboardText(eastl::string_view text) override;
             eastl::span<IMonitor*> GetMonitors() override;
             IMonitor* GetPrimaryMonitor() override;
+            IMonitor* GetMonitorForWindow(IWindow* window) override;
+            void RefreshMonitors() override;
+            IGamepadInput* GetGamepadInput() override;
             IWindow* CreateWindow(const WindowInfo& info) override;
             void DestroyWindow(IWindow*& window) override;
             ICursor* CreateCursor(CursorType type) override;
@@ -53,11 +63,22 @@ namespace PyroshockStudios {
 
             void InjectLogger(ILogStream* stream) override;
         private:
+            // GLFW has no event for _NET_WM_STATE_HIDDEN, it is read at this interval (in seconds)
+            // instead of paying a round trip per window on every poll
+            static constexpr f64 kHiddenStateInterval = 0.25;
+
+            void FinishPoll();
+
             static void MonitorConnectedCallback(GLFWmonitor* monitor);
             static void MonitorDisconnectedCallback(GLFWmonitor* monitor);
 
             eastl::vector<eastl::shared_ptr<GlfwMonitor>> mMonitorsStorage;
             eastl::vector<IMonitor*> mMonitors;
+            eastl::vector<GlfwWindow*> mWindows;
+            InputEventStream mEventStream = {};
+            GlfwGamepadSource mGamepadSource = {};
+            GamepadInput mGamepadInput = { &mGamepadSource };
+            f64 mNextHiddenCheck = 0.0;
             bool bInitialised = false;
         };
     } // namespace Platform
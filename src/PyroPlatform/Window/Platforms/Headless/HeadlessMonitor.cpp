@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HeadlessMonitor.hpp"
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        HeadlessMonitor::HeadlessMonitor(const HeadlessMonitorInfo& info) {
+            SetInfo(info);
+            Refresh();
+        }
+
+        eastl::string HeadlessMonitor::GetName() const {
+            return mCache.name;
+        }
+
+        Point HeadlessMonitor::GetPosition() const {
+            return mCache.position;
+        }
+
+        Size HeadlessMonitor::GetPhysicalSize() const {
+            return mCache.physicalSize;
+        }
+
+        Size HeadlessMonitor::GetResolution() const {
+            return mCache.currentMode.resolution;
+        }
+
+        Size HeadlessMonitor::GetWorkArea() const {
+            return mCache.workArea;
+        }
+
+        FSize HeadlessMonitor::GetContentScale() const {
+            return mCache.contentScale;
+        }
+
+        u32 HeadlessMonitor::GetRefreshRate() const {
+            return mCache.currentMode.refreshRate;
+        }
+
+        RefreshRate HeadlessMonitor::GetPreciseRefreshRate() const {
+            return mCache.preciseRefreshRate;
+        }
+
+        VideoMode HeadlessMonitor::GetCurrentVideoMode() const {
+            return mCache.currentMode;
+        }
+
+        eastl::span<const VideoMode> HeadlessMonitor::GetVideoModes() const {
+            return eastl::span<const VideoMode>(mCache.modes.data(), mCache.modes.size());
+        }
+
+        bool HeadlessMonitor::Refresh() {
+            const bool bChanged = mCache.position.x != mInfo.position.x || mCache.position.y != mInfo.position.y ||
+                                  mCache.physicalSize.width != mInfo.physicalSize.width ||
+                                  mCache.physicalSize.height != mInfo.physicalSize.height ||
+                                  mCache.workArea.width != mInfo.workArea.width || mCache.workArea.height != mInfo.workArea.height ||
+                                  mCache.contentScale.width != mInfo.contentScale.width ||
+                                  mCache.contentScale.height != mInfo.contentScale.height ||
+                                  !(mCache.currentMode == mInfo.currentMode) ||
+                                  !(mCache.preciseRefreshRate == mInfo.preciseRefreshRate) || mCache.modes != mInfo.modes;
+            mCache = mInfo;
+            return bChanged;
+        }
+
+        void HeadlessMonitor::SetInfo(const HeadlessMonitorInfo& info) {
+            mInfo = info;
+            // fill in what a real monitor always reports
+            if (!mInfo.preciseRefreshRate.IsValid()) {
+                mInfo.preciseRefreshRate = RefreshRate::FromHertz(mInfo.currentMode.refreshRate);
+            }
+            if (mInfo.modes.empty()) {
+                mInfo.modes.push_back(mInfo.currentMode);
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IMonitor.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // What a simulated monitor reports, defaults to a 24" 1080p panel at 60 Hz
+        struct HeadlessMonitorInfo {
+            eastl::string name = "Headless";
+            Point position = {};
+            Size physicalSize = { 527, 296 };
+            Size workArea = { 1920, 1080 };
+            FSize contentScale = { 1.0f, 1.0f };
+            VideoMode currentMode = { { 1920, 1080 }, 60, 8, 8, 8 };
+            // left invalid, the integer rate of currentMode over 1 is used
+            RefreshRate preciseRefreshRate = {};
+            // lowest to highest, left empty only currentMode is listed
+            eastl::vector<VideoMode> modes = {};
+        };
+
+        class HeadlessWindowManager;
+        class HeadlessMonitor : public IMonitor, DeleteCopy, DeleteMove {
+        public:
+            HeadlessMonitor(const HeadlessMonitorInfo& info);
+            ~HeadlessMonitor() = default;
+
+            eastl::string GetName() const override;
+            Point GetPosition() const override;
+            Size GetPhysicalSize() const override;
+            Size GetResolution() const override;
+            Size GetWorkArea() const override;
+            FSize GetContentScale() const override;
+            u32 GetRefreshRate() const override;
+            RefreshRate GetPreciseRefreshRate() const override;
+            VideoMode GetCurrentVideoMode() const override;
+            eastl::span<const VideoMode> GetVideoModes() const override;
+
+            // Copies the simulated state into the cache, returns true if anything changed
+            bool Refresh();
+
+        private:
+            friend class HeadlessWindowManager;
+            // Takes effect on the next Refresh(), see HeadlessWindowManager::UpdateMonitor()
+            void SetInfo(const HeadlessMonitorInfo& info);
+
+            HeadlessMonitorInfo mInfo = {};
+            HeadlessMonitorInfo mCache = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,378 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HeadlessWindow.hpp"
+#include <PyroPlatform/Window/IMonitor.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowInput.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowManager.hpp>
+
+#include <cstring>
+
+#include <libassert/assert.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            Size ScaleFramebuffer(Size size, FSize scale) {
+                return Size(static_cast<u32>(static_cast<f32>(size.width) * scale.width),
+                    static_cast<u32>(static_cast<f32>(size.height) * scale.height));
+            }
+        } // namespace
+
+        HeadlessWindow::HeadlessWindow(HeadlessWindowManager* manager, const WindowInfo& info)
+            : mManager(manager), bHighDPI(static_cast<bool>(info.flags & WindowCreateBits::HIGH_DPI)) {
+            mInput = new HeadlessWindowInput(this, manager);
+            mCache.size = Size(info.width, info.height);
+            mCache.framebufferSize = mCache.size;
+            mCache.title = info.title;
+            mCache.bVisible = static_cast<bool>(info.flags & WindowCreateBits::VISIBLE);
+            mCache.bPassthrough = static_cast<bool>(info.flags & WindowCreateBits::PASSTHROUGH);
+            mCache.bTopMost = static_cast<bool>(info.flags & WindowCreateBits::TOP_MOST);
+            mCache.bIconified = info.initialState == WindowState::Minimized;
+            mCache.bMaximized = info.initialState == WindowState::Maximized;
+            mCache.visibility = ComputeVisibility();
+        }
+        HeadlessWindow::~HeadlessWindow() {
+            delete mInput;
+        }
+
+        Size HeadlessWindow::GetSize() const {
+            return mCache.size;
+        }
+
+        Point HeadlessWindow::GetPosition() const {
+            return mCache.position;
+        }
+
+        Point HeadlessWindow::GetCursorPosition() const {
+            return mCache.cursorPosition;
+        }
+
+        f32 HeadlessWindow::GetOpacity() const {
+            return mCache.opacity;
+        }
+
+        void HeadlessWindow::SetSize(Size size) {
+            if (size.width == mCache.size.width && size.height == mCache.size.height) {
+                return;
+            }
+            mCache.size = size;
+            mInput->Inject(InputEventRecord::WindowResize(size.width, size.height));
+            UpdateFramebufferSize();
+        }
+
+        void HeadlessWindow::SetPosition(Point point) {
+            if (point.x == mCache.position.x && point.y == mCache.position.y) {
+                return;
+            }
+            mCache.position = point;
+            mInput->Inject(InputEventRecord::WindowPosition(static_cast<f64>(point.x), static_cast<f64>(point.y)));
+        }
+
+        void HeadlessWindow::SetCursorPosition(Point point) {
+            // reported like any other motion, so the snapshot and the deltas stay in step
+            mInput->InjectCursorPosition(static_cast<f64>(point.x), static_cast<f64>(point.y));
+        }
+
+        void HeadlessWindow::SetCursorVisible(bool bVisible) {
+            mCache.cursorMode = bVisible ? CursorMode::Normal : CursorMode::Hidden;
+        }
+
+        void HeadlessWindow::SetCursorLockedToWindow(bool bLocked) {
+            mCache.cursorMode = bLocked ? CursorMode::Locked : CursorMode::Normal;
+        }
+
+        void HeadlessWindow::SetOpacity(f32 opacity) {
+            mCache.opacity = opacity;
+        }
+
+        void HeadlessWindow::SetCursor(ICursor* cursor) {
+            mCursor = cursor;
+        }
+
+        void HeadlessWindow::SetFullscreen(IMonitor* monitor) {
+            mCache.fullscreen = monitor;
+            if (monitor) {
+                // the size is kept, like GLFW does when given the current one
+                SetPosition(monitor->GetPosition());
+            }
+        }
+
+        void HeadlessWindow::SetWindowState(WindowState state) {
+            switch (state) {
+            case WindowState::Minimized:
+                if (!mCache.bIconified) {
+                    mCache.bIconified = true;
+                    mInput->Inject(InputEventRecord::WindowIconify(true));
+                    UpdateVisibility();
+                }
+                break;
+            case WindowState::Maximized:
+                if (mCache.bIconified) {
+                    mCache.bIconified = false;
+                    mInput->Inject(InputEventRecord::WindowIconify(false));
+                    UpdateVisibility();
+                }
+                if (!mCache.bMaximized) {
+                    mCache.bMaximized = true;
+                    mInput->Inject(InputEventRecord::WindowMaximize(true));
+                }
+                break;
+            case WindowState::Normal:
+                // restoring leaves the minimised state first, same as the window systems
+                if (mCache.bIconified) {
+                    mCache.bIconified = false;
+                    mInput->Inject(InputEventRecord::WindowIconify(false));
+                    UpdateVisibility();
+                } else if (mCache.bMaximized) {
+                    mCache.bMaximized = false;
+                    mInput->Inject(InputEventRecord::WindowMaximize(false));
+                }
+                break;
+            }
+        }
+
+        WindowState HeadlessWindow::GetWindowState() const {
+            if (mCache.bIconified)
+                return WindowState::Minimized;
+            if (mCache.bMaximized)
+                return WindowState::Maximized;
+            return WindowState::Normal;
+        }
+
+        eastl::string HeadlessWindow::GetTitle() const {
+            return mCache.title;
+        }
+
+        void HeadlessWindow::SetTitle(eastl::string_view title) {
+            mCache.title.assign(title.data(), title.size());
+        }
+
+        Size HeadlessWindow::GetFramebufferSize() const {
+            return mCache.framebufferSize;
+        }
+
+        f32 HeadlessWindow::GetDPIScale() const {
+            if (mCache.size.width == 0) {
+                return 1.0f;
+            }
+            return static_cast<f32>(mCache.framebufferSize.width) / static_cast<f32>(mCache.size.width);
+        }
+
+        FSize HeadlessWindow::GetContentScale() const {
+            return mCache.contentScale;
+        }
+
+        CursorMode HeadlessWindow::GetCursorMode() const {
+            return mCache.cursorMode;
+        }
+
+        bool HeadlessWindow::IsStickyKeysEnabled() const {
+            return mCache.bStickyKeys;
+        }
+
+        bool HeadlessWindow::IsStickyMouseButtonsEnabled() const {
+            return mCache.bStickyMouseButtons;
+        }
+
+        bool HeadlessWindow::IsRawMouseMotionEnabled() const {
+            return mCache.bRawMouseMotion;
+        }
+
+        void HeadlessWindow::SetCursorMode(CursorMode mode) {
+            mCache.cursorMode = mode;
+        }
+
+        void HeadlessWindow::SetStickyKeysEnabled(bool bEnabled) {
+            mCache.bStickyKeys = bEnabled;
+        }
+
+        void HeadlessWindow::SetStickyMouseButtonsEnabled(bool bEnabled) {
+            mCache.bStickyMouseButtons = bEnabled;
+        }
+
+        void HeadlessWindow::SetRawMouseMotionEnabled(bool bEnabled) {
+            mCache.bRawMouseMotion = bEnabled;
+        }
+
+        void HeadlessWindow::Show() {
+            mCache.bVisible = true;
+            UpdateVisibility();
+        }
+
+        void HeadlessWindow::Hide() {
+            mCache.bVisible = false;
+            if (mCache.bFocused) {
+                mManager->SetFocusedWindow(nullptr);
+            }
+            UpdateVisibility();
+        }
+
+        void HeadlessWindow::Close() {
+            mCache.bShouldClose = true;
+        }
+
+        void HeadlessWindow::CancelClose() {
+            mCache.bShouldClose = false;
+        }
+
+        void HeadlessWindow::Focus() {
+            // same rule as glfwFocusWindow, only visible windows that are not minimised take focus
+            if (mCache.bVisible && !mCache.bIconified) {
+                mManager->SetFocusedWindow(this);
+            }
+        }
+
+        void HeadlessWindow::SetPassthrough(bool bPassthrough) {
+            mCache.bPassthrough = bPassthrough;
+        }
+
+        void HeadlessWindow::SetTopMost(bool bTopMost) {
+            mCache.bTopMost = bTopMost;
+        }
+
+        void HeadlessWindow::RequestAttention() {
+            ++mAttentionRequests;
+        }
+
+        bool HeadlessWindow::IsVisible() const {
+            return mCache.bVisible;
+        }
+
+        WindowVisibilityState HeadlessWindow::GetVisibilityState() const {
+            return mCache.visibility;
+        }
+
+        bool HeadlessWindow::ShouldClose() const {
+            return mCache.bShouldClose;
+        }
+
+        bool HeadlessWindow::IsFocused() const {
+            return mCache.bFocused;
+        }
+
+        bool HeadlessWindow::IsHovered() const {
+            return mCache.bHovered;
+        }
+
+        void HeadlessWindow::Refresh() {
+        }
+
+        IWindowInput* HeadlessWindow::GetInputHandler() {
+            return mInput;
+        }
+
+        bool HeadlessWindow::PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            ASSERT(stride >= size.width * 4, "Stride is shorter than a row!");
+            ASSERT(size.height == 0 || pixels.size() >= static_cast<usize>(stride) * (size.height - 1) + size.width * 4, "Pixel buffer is smaller than the image!");
+            if (!(mPresentedSize == size)) {
+                // a new size starts out black, like a freshly resized X window
+                mPresentedSize = size;
+                mPresented.assign(static_cast<usize>(size.width) * size.height, 0);
+            }
+            mPresentedRects.clear();
+            const WindowRect whole = { 0, 0, size.width, size.height };
+            for (const WindowRect& dirty : dirtyRects.empty() ? eastl::span<const WindowRect>(&whole, 1) : dirtyRects) {
+                const WindowRect rect = dirty.Clipped(size);
+                if (rect.IsEmpty()) {
+                    continue;
+                }
+                for (u32 row = 0; row < rect.height; ++row) {
+                    const usize y = static_cast<usize>(rect.y) + row;
+                    memcpy(&mPresented[y * size.width + rect.x], &pixels[y * stride + static_cast<usize>(rect.x) * 4], rect.width * 4);
+                }
+                mPresentedRects.push_back(rect);
+            }
+            return true;
+        }
+
+        NativeHandle HeadlessWindow::GetNativeWindow() const {
+            return {};
+        }
+
+        NativeHandle HeadlessWindow::GetNativeInstance() const {
+            return {};
+        }
+
+        void HeadlessWindow::InjectCloseRequest() {
+            mCache.bShouldClose = true;
+            mInput->Inject(InputEventRecord::WindowClose());
+        }
+
+        void HeadlessWindow::InjectContentScale(FSize scale) {
+            if (scale.width == mCache.contentScale.width && scale.height == mCache.contentScale.height) {
+                return;
+            }
+            mCache.contentScale = scale;
+            mInput->Inject(InputEventRecord::WindowContentScale(static_cast<f64>(scale.width), static_cast<f64>(scale.height)));
+            UpdateFramebufferSize();
+        }
+
+        void HeadlessWindow::InjectExpose(eastl::span<const WindowRect> rects) {
+            for (usize i = 0; i < rects.size(); ++i) {
+                const WindowRect& rect = rects[i];
+                mInput->Inject(InputEventRecord::WindowExpose(rect.x, rect.y, rect.width, rect.height, static_cast<u32>(rects.size() - i - 1)));
+            }
+        }
+
+        void HeadlessWindow::InjectOcclusion(WindowVisibilityState occlusion) {
+            mCache.occlusion = occlusion;
+            UpdateVisibility();
+        }
+
+        void HeadlessWindow::UpdateVisibility() {
+            const WindowVisibilityState visibility = ComputeVisibility();
+            if (visibility == mCache.visibility) {
+                return;
+            }
+            mCache.visibility = visibility;
+            mInput->Inject(InputEventRecord::WindowVisibility(visibility));
+        }
+
+        WindowVisibilityState HeadlessWindow::ComputeVisibility() const {
+            if (mCache.bIconified) {
+                return WindowVisibilityState::Iconified;
+            }
+            if (!mCache.bVisible || mCache.occlusion == WindowVisibilityState::Iconified) {
+                return WindowVisibilityState::FullyObscured;
+            }
+            return mCache.occlusion;
+        }
+
+        void HeadlessWindow::SetFocused(bool bFocused) {
+            if (bFocused == mCache.bFocused) {
+                return;
+            }
+            mCache.bFocused = bFocused;
+            mInput->Inject(InputEventRecord::WindowFocus(bFocused));
+        }
+
+        void HeadlessWindow::UpdateFramebufferSize() {
+            const Size framebufferSize = bHighDPI ? ScaleFramebuffer(mCache.size, mCache.contentScale) : mCache.size;
+            if (framebufferSize.width == mCache.framebufferSize.width && framebufferSize.height == mCache.framebufferSize.height) {
+                return;
+            }
+            mCache.framebufferSize = framebufferSize;
+            mInput->Inject(InputEventRecord::WindowFramebufferResize(framebufferSize.width, framebufferSize.height));
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,171 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class HeadlessWindowManager;
+        class HeadlessWindowInput;
+        // In-memory window. Every state change updates the cache right away and sends the event a
+        // windowing system would report for it, through the same path as injected input.
+        class HeadlessWindow : public IWindow, DeleteCopy, DeleteMove {
+        public:
+            HeadlessWindow(HeadlessWindowManager* manager, const WindowInfo& info);
+            ~HeadlessWindow();
+
+            Size GetSize() const override;
+            Point GetPosition() const override;
+            Point GetCursorPosition() const override;
+            f32 GetOpacity() const override;
+            void SetSize(Size size) override;
+            void SetPosition(Point point) override;
+            void SetCursorPosition(Point point) override;
+            void SetCursorVisible(bool bVisible) override;
+            void SetCursorLockedToWindow(bool bLocked) override;
+            void SetOpacity(f32 opacity) override;
+            void SetCursor(ICursor* cursor) override;
+            void SetFullscreen(IMonitor* monitor) override;
+            void SetWindowState(WindowState state) override;
+            WindowState GetWindowState() const override;
+            eastl::string GetTitle() const override;
+            void SetTitle(eastl::string_view title) override;
+            Size GetFramebufferSize() const override;
+            f32 GetDPIScale() const override;
+            FSize GetContentScale() const override;
+            CursorMode GetCursorMode() const override;
+            bool IsStickyKeysEnabled() const override;
+            bool IsStickyMouseButtonsEnabled() const override;
+            bool IsRawMouseMotionEnabled() const override;
+            void SetCursorMode(CursorMode mode) override;
+            void SetStickyKeysEnabled(bool bEnabled) override;
+            void SetStickyMouseButtonsEnabled(bool bEnabled) override;
+            void SetRawMouseMotionEnabled(bool bEnabled) override;
+            void Show() override;
+            void Hide() override;
+            void Close() override;
+            void CancelClose() override;
+            void Focus() override;
+            void SetPassthrough(bool bPassthrough) override;
+            void SetTopMost(bool bTopMost) override;
+            void RequestAttention() override;
+            bool IsVisible() const override;
+            bool ShouldClose() const override;
+            bool IsFocused() const override;
+            bool IsHovered() const override;
+            WindowVisibilityState GetVisibilityState() const override;
+
+            // The cache is the window, there is nothing to re-read
+            void Refresh() override;
+
+            IWindowInput* GetInputHandler() override;
+
+            // Copies into an in-memory framebuffer, see GetPresentedPixels()
+            bool PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects = {}) override;
+
+            // There is no native window, both are null
+            NativeHandle GetNativeWindow() const override;
+            NativeHandle GetNativeInstance() const override;
+
+            // Simulates the user pressing the close button, marks ShouldClose and sends a WindowCloseEvent
+            void InjectCloseRequest();
+            // Simulates the window landing on a monitor with another scale. HIGH_DPI windows
+            // get a framebuffer scaled to match, like on a Retina display.
+            void InjectContentScale(FSize scale);
+            // Simulates part of the window being uncovered, the rectangles arrive as one series
+            void InjectExpose(eastl::span<const WindowRect> rects);
+            // Simulates other windows covering part or all of this one. Hiding and iconifying
+            // still win over it, like they do on X11.
+            void InjectOcclusion(WindowVisibilityState occlusion);
+
+            HeadlessWindowInput* GetHeadlessInput() const {
+                return mInput;
+            }
+            IMonitor* GetFullscreenMonitor() const {
+                return mCache.fullscreen;
+            }
+            u32 GetAttentionRequestCount() const {
+                return mAttentionRequests;
+            }
+            // What PresentPixels() left on the window, tightly packed rows of GetPresentedSize().width
+            eastl::span<const u32> GetPresentedPixels() const {
+                return eastl::span<const u32>(mPresented.data(), mPresented.size());
+            }
+            Size GetPresentedSize() const {
+                return mPresentedSize;
+            }
+            // The rectangles the last PresentPixels() uploaded, after clipping
+            eastl::span<const WindowRect> GetPresentedRects() const {
+                return eastl::span<const WindowRect>(mPresentedRects.data(), mPresentedRects.size());
+            }
+
+        private:
+            friend class HeadlessWindowManager;
+            friend class HeadlessWindowInput;
+
+            // Sent by the manager when focus moves between windows
+            void SetFocused(bool bFocused);
+            void UpdateFramebufferSize();
+            void UpdateVisibility();
+            WindowVisibilityState ComputeVisibility() const;
+
+            struct PropertyCache {
+                Size size = {};
+                Size framebufferSize = {};
+                Point position = {};
+                Point cursorPosition = {};
+                FSize contentScale = { 1.0f, 1.0f };
+                IMonitor* fullscreen = nullptr;
+                eastl::string title = {};
+                f32 opacity = 1.0f;
+                CursorMode cursorMode = CursorMode::Normal;
+                bool bStickyKeys = false;
+                bool bStickyMouseButtons = false;
+                bool bRawMouseMotion = false;
+                bool bVisible = false;
+                bool bShouldClose = false;
+                bool bFocused = false;
+                bool bHovered = false;
+                bool bIconified = false;
+                bool bMaximized = false;
+                bool bPassthrough = false;
+                bool bTopMost = false;
+                WindowVisibilityState occlusion = WindowVisibilityState::Visible;
+                WindowVisibilityState visibility = WindowVisibilityState::FullyObscured;
+            };
+
+            PropertyCache mCache = {};
+            HeadlessWindowManager* mManager = nullptr;
+            HeadlessWindowInput* mInput = nullptr;
+            ICursor* mCursor = nullptr;
+            eastl::vector<u32> mPresented = {};
+            eastl::vector<WindowRect> mPresentedRects = {};
+            Size mPresentedSize = {};
+            u32 mAttentionRequests = 0;
+            bool bHighDPI = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
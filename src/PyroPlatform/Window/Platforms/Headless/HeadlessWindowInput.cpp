@@ -0,0 +1,147 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HeadlessWindowInput.hpp"
+#include <PyroPlatform/Window/Input/Utf8.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowManager.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        HeadlessWindowInput::HeadlessWindowInput(HeadlessWindow* window, HeadlessWindowManager* manager)
+            : mWindow(window), mManager(manager) {
+            mEvents = new WindowEvents;
+            mEvents->SetClock(manager->mClock);
+        }
+        HeadlessWindowInput::~HeadlessWindowInput() {
+            delete mEvents;
+        }
+        bool HeadlessWindowInput::IsKeyDown(KeyCode key) {
+            return mPublished.IsKeyDown(key);
+        }
+
+        bool HeadlessWindowInput::IsMouseDown(MouseButton button) {
+            return mPublished.IsMouseDown(button);
+        }
+        bool HeadlessWindowInput::WasPressed(KeyCode key) const {
+            return mPublished.WasPressed(key);
+        }
+        bool HeadlessWindowInput::WasReleased(KeyCode key) const {
+            return mPublished.WasReleased(key);
+        }
+        bool HeadlessWindowInput::WasPressed(MouseButton button) const {
+            return mPublished.WasPressed(button);
+        }
+        bool HeadlessWindowInput::WasReleased(MouseButton button) const {
+            return mPublished.WasReleased(button);
+        }
+        InputSnapshot HeadlessWindowInput::GetSnapshot() const {
+            return mShared.Load();
+        }
+        void HeadlessWindowInput::PublishSnapshot() {
+            mPublished = mState;
+            mShared.Store(mPublished);
+            mState.ClearFrame();
+        }
+        WindowEvents& HeadlessWindowInput::GetEvents() {
+            return *mEvents;
+        }
+        void HeadlessWindowInput::SetBufferedEvents(bool bEnabled) {
+            if (!bEnabled) {
+                // don't lose what was recorded while buffering was on
+                DrainEvents();
+            }
+            bBuffered = bEnabled;
+        }
+        bool HeadlessWindowInput::IsBufferedEvents() const {
+            return bBuffered;
+        }
+        void HeadlessWindowInput::DrainEvents() {
+            while (!mQueue.Empty()) {
+                // copy out first, handlers may inject new events
+                const InputEventRecord record = mQueue.Front();
+                mQueue.Pop();
+                mEvents->Dispatch(*mWindow, record);
+            }
+            mEvents->FlushText();
+        }
+        void HeadlessWindowInput::SetEventCoalescing(InputEventType type, bool bEnabled) {
+            mQueue.SetCoalescing(type, bEnabled);
+        }
+        u64 HeadlessWindowInput::GetCoalescedCount(InputEventType type) const {
+            return mQueue.GetMergedCount(type);
+        }
+
+        void HeadlessWindowInput::Inject(InputEventRecord record) {
+            record.timestamp = mManager->mClock ? mManager->mClock->GetTicks() : 0;
+            record.sequence = mManager->mEventSequence++;
+            mState.Apply(record);
+            mManager->mEventStream.Push(*mWindow, record);
+            if (bBuffered) {
+                mQueue.Push(record);
+            } else {
+                mEvents->Dispatch(*mWindow, record);
+            }
+        }
+        // There is no keyboard layout, the key code doubles as the scan code
+        void HeadlessWindowInput::InjectKey(KeyCode key, bool bDown, InputModifiers::Flags mods) {
+            Inject(InputEventRecord::Key(key, static_cast<i32>(key), mods, bDown, false));
+        }
+        void HeadlessWindowInput::InjectKeyRepeat(KeyCode key, InputModifiers::Flags mods) {
+            Inject(InputEventRecord::Key(key, static_cast<i32>(key), mods, true, true));
+        }
+        void HeadlessWindowInput::InjectMouseButton(MouseButton button, bool bDown, InputModifiers::Flags mods) {
+            Inject(InputEventRecord::Mouse(button, mods, bDown));
+        }
+        // The window property cache is updated before injecting, so handlers already see the new values
+        void HeadlessWindowInput::InjectCursorPosition(f64 x, f64 y) {
+            mWindow->mCache.cursorPosition = ToCursorPoint(x, y);
+            // the first motion has nothing to be relative to, it would report the absolute position as the delta
+            const f64 deltaX = bCursorTracked ? x - mState.cursorX : 0.0;
+            const f64 deltaY = bCursorTracked ? y - mState.cursorY : 0.0;
+            bCursorTracked = true;
+            Inject(InputEventRecord::CursorPosition(x, y, deltaX, deltaY));
+        }
+        void HeadlessWindowInput::InjectScroll(f64 x, f64 y) {
+            Inject(InputEventRecord::CursorScroll(x, y));
+        }
+        void HeadlessWindowInput::InjectCursorEnter(bool bEntered) {
+            mWindow->mCache.bHovered = bEntered;
+            if (bEntered) {
+                bCursorTracked = false;
+            }
+            Inject(InputEventRecord::CursorEnter(bEntered));
+        }
+        void HeadlessWindowInput::InjectChar(u32 codePoint) {
+            Inject(InputEventRecord::CharInput(codePoint));
+        }
+        void HeadlessWindowInput::InjectText(eastl::string_view utf8) {
+            u32 codePoint = 0;
+            while (const usize length = DecodeUtf8(utf8, codePoint)) {
+                InjectChar(codePoint);
+                utf8.remove_prefix(length);
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
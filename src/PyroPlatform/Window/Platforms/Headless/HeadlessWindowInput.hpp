@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string_view.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Forward.hpp>
+#include <PyroPlatform/Window/IWindowInput.hpp>
+#include <PyroPlatform/Window/Input/InputEventQueue.hpp>
+#include <PyroPlatform/Window/Input/InputSnapshot.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class HeadlessWindowManager;
+        class HeadlessWindow;
+        class HeadlessWindowInput : public IWindowInput, DeleteCopy, DeleteMove {
+        public:
+            HeadlessWindowInput(HeadlessWindow* window, HeadlessWindowManager* manager);
+            ~HeadlessWindowInput();
+
+            bool IsKeyDown(KeyCode key) override;
+            bool IsMouseDown(MouseButton button) override;
+            bool WasPressed(KeyCode key) const override;
+            bool WasReleased(KeyCode key) const override;
+            bool WasPressed(MouseButton button) const override;
+            bool WasReleased(MouseButton button) const override;
+            InputSnapshot GetSnapshot() const override;
+            void PublishSnapshot() override;
+
+            WindowEvents& GetEvents() override;
+
+            void SetBufferedEvents(bool bBuffered) override;
+            bool IsBufferedEvents() const override;
+            void DrainEvents() override;
+            void SetEventCoalescing(InputEventType type, bool bEnabled) override;
+            u64 GetCoalescedCount(InputEventType type) const override;
+
+            // Scripted input. Each call takes the path a platform callback would: the record is stamped,
+            // applied to the live state, pushed to the manager's stream and then dispatched, or buffered.
+            // Snapshots still only change on the next IWindowManager::PollEvents().
+            void Inject(InputEventRecord record);
+            void InjectKey(KeyCode key, bool bDown, InputModifiers::Flags mods = 0);
+            void InjectKeyRepeat(KeyCode key, InputModifiers::Flags mods = 0);
+            void InjectMouseButton(MouseButton button, bool bDown, InputModifiers::Flags mods = 0);
+            // Moves the window's cursor, the deltas are taken from the previous position
+            void InjectCursorPosition(f64 x, f64 y);
+            void InjectScroll(f64 x, f64 y);
+            void InjectCursorEnter(bool bEntered);
+            void InjectChar(u32 codePoint);
+            // One CharInputEvent per code point, they reach TextInputEvent handlers as a single run
+            void InjectText(eastl::string_view utf8);
+
+            InputEventQueue& GetEventQueue() {
+                return mQueue;
+            }
+            HeadlessWindow* GetWindow() const {
+                return mWindow;
+            }
+
+        private:
+
+            HeadlessWindow* mWindow = nullptr;
+            HeadlessWindowManager* mManager = nullptr;
+            WindowEvents* mEvents = nullptr;
+            InputEventQueue mQueue = {};
+            // live state follows events as they arrive, the published copy is what queries see
+            InputSnapshot mState = {};
+            InputSnapshot mPublished = {};
+            // the published copy again, for GetSnapshot() from other threads
+            InputSnapshotBuffer mShared;
+            bool bBuffered = false;
+            // whether mState holds a real cursor position to take motion deltas from,
+            // cleared again when the cursor enters since it moved while outside
+            bool bCursorTracked = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,295 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HeadlessWindowManager.hpp"
+#include <EASTL/algorithm.h>
+#include <PyroCommon/Logger.hpp>
+#include <PyroPlatform/Factory.hpp>
+#include <PyroPlatform/Window/MonitorEvent.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessCursor.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowInput.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+#include <libassert/assert.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        bool HeadlessWindowManager::Init() {
+#ifdef PYRO_PLATFORM_TIME
+            if (mClock == nullptr) {
+                mClock = PlatformFactory::Get<IClock>();
+            }
+#endif
+            Logger::Trace(mSink, "Initialising headless window manager");
+            mEventStream.GetEvents().SetClock(mClock);
+            mMonitors.clear();
+            mMonitorsStorage.clear();
+            mMonitorsStorage.emplace_back(eastl::make_unique<HeadlessMonitor>(HeadlessMonitorInfo{}));
+            mMonitors.push_back(mMonitorsStorage.back().get());
+            bMonitorsDirty = false;
+            bInitialised = true;
+            return true;
+        }
+
+        bool HeadlessWindowManager::Terminate() {
+            Logger::Trace(mSink, "Terminating headless window manager");
+            // the windows go with the manager, like they do with glfwTerminate
+            for (HeadlessWindow* window : mWindows) {
+                mEventStream.Remove(window);
+                delete window;
+            }
+            mWindows.clear();
+            mFocused = nullptr;
+            mMonitors.clear();
+            mMonitorsStorage.clear();
+            bInitialised = false;
+            return true;
+        }
+
+        void HeadlessWindowManager::PollEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            FinishPoll();
+            mGamepadInput.Poll();
+        }
+        void HeadlessWindowManager::WaitEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            FinishPoll();
+            mGamepadInput.Poll();
+        }
+        void HeadlessWindowManager::DrainEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            // merge the per-window queues by arrival order, there are only ever a handful of windows
+            for (;;) {
+                HeadlessWindowInput* next = nullptr;
+                for (HeadlessWindow* window : mWindows) {
+                    HeadlessWindowInput* input = window->GetHeadlessInput();
+                    InputEventQueue& queue = input->GetEventQueue();
+                    if (queue.Empty()) {
+                        continue;
+                    }
+                    if (!next || queue.Front().sequence < next->GetEventQueue().Front().sequence) {
+                        next = input;
+                    }
+                }
+                if (!next) {
+                    break;
+                }
+                const InputEventRecord record = next->GetEventQueue().Front();
+                next->GetEventQueue().Pop();
+                next->GetEvents().Dispatch(*next->GetWindow(), record);
+            }
+            for (HeadlessWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().FlushText();
+            }
+        }
+        void HeadlessWindowManager::InjectClock(IClock* clock) {
+            mClock = clock;
+            mEventStream.GetEvents().SetClock(clock);
+            for (HeadlessWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().SetClock(clock);
+            }
+        }
+        WindowEvents& HeadlessWindowManager::GetEvents() {
+            return mEventStream.GetEvents();
+        }
+        void HeadlessWindowManager::FinishPoll() {
+            for (HeadlessWindow* window : mWindows) {
+                IWindowInput* input = window->GetInputHandler();
+                // text injected since the last poll goes out as one run, buffered windows do this on drain
+                input->GetEvents().FlushText();
+                input->PublishSnapshot();
+            }
+            mEventStream.Dispatch();
+            if (bMonitorsDirty) {
+                RefreshMonitors();
+            }
+        }
+
+        bool HeadlessWindowManager::HasClipboardText() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return bHasClipboardText;
+        }
+
+        eastl::string HeadlessWindowManager::GetClipboardText() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return mClipboard;
+        }
+
+        void HeadlessWindowManager::SetClipboardText(eastl::string_view text) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            mClipboard.assign(text.data(), text.size());
+            bHasClipboardText = true;
+        }
+
+        eastl::span<IMonitor*> HeadlessWindowManager::GetMonitors() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return eastl::span<IMonitor*>(mMonitors.data(), mMonitors.size());
+        }
+
+        IMonitor* HeadlessWindowManager::GetPrimaryMonitor() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            if (mMonitors.empty()) {
+                Logger::Error(mSink, "No monitor was found! Reason: every headless monitor was disconnected");
+                return nullptr;
+            }
+            return mMonitors.front();
+        }
+        IMonitor* HeadlessWindowManager::GetMonitorForWindow(IWindow* window) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            ASSERT(dynamic_cast<HeadlessWindow*>(window) != nullptr, "Type must be of HeadlessWindow!");
+            if (IMonitor* fullscreen = static_cast<HeadlessWindow*>(window)->GetFullscreenMonitor()) {
+                return fullscreen;
+            }
+            const Point position = window->GetPosition();
+            const Size size = window->GetSize();
+            const i64 left = static_cast<i32>(position.x);
+            const i64 top = static_cast<i32>(position.y);
+            const i64 right = left + size.width;
+            const i64 bottom = top + size.height;
+
+            IMonitor* best = nullptr;
+            i64 bestArea = 0;
+            for (IMonitor* monitor : mMonitors) {
+                const Point monitorPosition = monitor->GetPosition();
+                const Size resolution = monitor->GetResolution();
+                const i64 monitorLeft = static_cast<i32>(monitorPosition.x);
+                const i64 monitorTop = static_cast<i32>(monitorPosition.y);
+                const i64 width = eastl::min(right, monitorLeft + resolution.width) - eastl::max(left, monitorLeft);
+                const i64 height = eastl::min(bottom, monitorTop + resolution.height) - eastl::max(top, monitorTop);
+                if (width > 0 && height > 0 && width * height > bestArea) {
+                    best = monitor;
+                    bestArea = width * height;
+                }
+            }
+            return best;
+        }
+        void HeadlessWindowManager::RefreshMonitors() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            bMonitorsDirty = false;
+            for (IMonitor* monitor : mMonitors) {
+                if (static_cast<HeadlessMonitor*>(monitor)->Refresh()) {
+                    MonitorEvent event(*monitor, MonitorEventType::Changed);
+                    mEventStream.GetEvents().Emit(event);
+                }
+            }
+        }
+        IGamepadInput* HeadlessWindowManager::GetGamepadInput() {
+            return &mGamepadInput;
+        }
+
+        IWindow* HeadlessWindowManager::CreateWindow(const WindowInfo& info) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            Logger::Trace(mSink, "Creating window \"{}\" with size {}x{}", info.title, info.width, info.height);
+            HeadlessWindow* window = new HeadlessWindow(this, info);
+            mWindows.push_back(window);
+            if ((info.flags & WindowCreateBits::VISIBLE) && (info.flags & WindowCreateBits::FOCUSED)) {
+                window->Focus();
+            }
+            return window;
+        }
+
+        void HeadlessWindowManager::DestroyWindow(IWindow*& window) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            ASSERT(dynamic_cast<HeadlessWindow*>(window) != nullptr, "Type must be of HeadlessWindow!");
+            Logger::Trace(mSink, "Destroying window \"{}\"", window->GetTitle());
+            HeadlessWindow* wnd = static_cast<HeadlessWindow*>(window);
+            if (mFocused == wnd) {
+                mFocused = nullptr;
+            }
+            mWindows.erase(eastl::remove(mWindows.begin(), mWindows.end(), wnd), mWindows.end());
+            delete wnd;
+            mEventStream.Remove(window);
+            window = nullptr;
+        }
+
+        ICursor* HeadlessWindowManager::CreateCursor(CursorType type) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return new HeadlessCursor(type);
+        }
+
+        void HeadlessWindowManager::DestroyCursor(ICursor*& cursor) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            delete static_cast<HeadlessCursor*>(cursor);
+            cursor = nullptr;
+        }
+
+        KeyCode HeadlessWindowManager::TranslateKey(i32 key, i32 scancode, KeySource source) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return static_cast<KeyCode>(key);
+        }
+
+        void HeadlessWindowManager::InjectLogger(ILogStream* stream) {
+            mSink = stream;
+        }
+
+        HeadlessMonitor* HeadlessWindowManager::ConnectMonitor(const HeadlessMonitorInfo& info) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            Logger::Info(mSink, "Monitor \"{}\" connected", info.name);
+            mMonitorsStorage.emplace_back(eastl::make_unique<HeadlessMonitor>(info));
+            HeadlessMonitor* monitor = mMonitorsStorage.back().get();
+            mMonitors.push_back(monitor);
+            MonitorEvent event(*monitor, MonitorEventType::Connected);
+            mEventStream.GetEvents().Emit(event);
+            return monitor;
+        }
+
+        void HeadlessWindowManager::DisconnectMonitor(IMonitor* monitor) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            auto it = eastl::find_if(mMonitorsStorage.begin(), mMonitorsStorage.end(),
+                [monitor](const eastl::unique_ptr<HeadlessMonitor>& m) { return m.get() == monitor; });
+            if (it == mMonitorsStorage.end()) {
+                return;
+            }
+            Logger::Info(mSink, "Monitor \"{}\" disconnected", monitor->GetName());
+            for (HeadlessWindow* window : mWindows) {
+                if (window->GetFullscreenMonitor() == monitor) {
+                    window->SetFullscreen(nullptr);
+                }
+            }
+            MonitorEvent event(*monitor, MonitorEventType::Disconnected);
+            mEventStream.GetEvents().Emit(event);
+            mMonitors.erase(eastl::remove(mMonitors.begin(), mMonitors.end(), monitor), mMonitors.end());
+            mMonitorsStorage.erase(it);
+        }
+
+        void HeadlessWindowManager::UpdateMonitor(IMonitor* monitor, const HeadlessMonitorInfo& info) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            static_cast<HeadlessMonitor*>(monitor)->SetInfo(info);
+            bMonitorsDirty = true;
+        }
+
+        void HeadlessWindowManager::SetFocusedWindow(HeadlessWindow* window) {
+            if (mFocused == window) {
+                return;
+            }
+            HeadlessWindow* previous = mFocused;
+            mFocused = window;
+            if (previous) {
+                previous->SetFocused(false);
+            }
+            if (window) {
+                window->SetFocused(true);
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
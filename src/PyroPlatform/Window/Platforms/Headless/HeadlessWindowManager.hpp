@@ -0,0 +1,107 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include "HeadlessMonitor.hpp"
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Forward.hpp>
+#include <PyroPlatform/Window/IWindowManager.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/Input/GamepadInput.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class HeadlessWindow;
+        class HeadlessWindowInput;
+        // Window manager without a display, for CI, servers and benchmarks. Windows, monitors and the
+        // clipboard live in memory, input is scripted through HeadlessWindowInput and everything else
+        // behaves like a real backend: same property caches, same events, same stream ordering.
+        // Starts with one default HeadlessMonitorInfo monitor, gamepads come from IGamepadInput::SetSource().
+        class HeadlessWindowManager : public IWindowManager, DeleteCopy, DeleteMove {
+        public:
+            bool Init() override;
+            bool Terminate() override;
+
+            void PollEvents() override;
+            // Nothing can arrive while blocked, so this returns right away like PollEvents()
+            void WaitEvents() override;
+            void DrainEvents() override;
+            void InjectClock(IClock* clock) override;
+            WindowEvents& GetEvents() override;
+
+            bool HasClipboardText() override;
+            eastl::string GetClipboardText() override;
+            void SetClipboardText(eastl::string_view text) override;
+            eastl::span<IMonitor*> GetMonitors() override;
+            IMonitor* GetPrimaryMonitor() override;
+            IMonitor* GetMonitorForWindow(IWindow* window) override;
+            void RefreshMonitors() override;
+            IGamepadInput* GetGamepadInput() override;
+            IWindow* CreateWindow(const WindowInfo& info) override;
+            void DestroyWindow(IWindow*& window) override;
+            ICursor* CreateCursor(CursorType type) override;
+            void DestroyCursor(ICursor*& cursor) override;
+            // There is no keyboard layout, both sources return the key as is
+            KeyCode TranslateKey(i32 key, i32 scancode, KeySource source) override;
+
+            void InjectLogger(ILogStream* stream) override;
+
+            // Scripted hotplug, the MonitorEvent is emitted right away like from a platform callback
+            HeadlessMonitor* ConnectMonitor(const HeadlessMonitorInfo& info);
+            // Windows fullscreen on the monitor leave fullscreen
+            void DisconnectMonitor(IMonitor* monitor);
+            // Changes what the monitor reports, noticed on the next poll or RefreshMonitors()
+            void UpdateMonitor(IMonitor* monitor, const HeadlessMonitorInfo& info);
+
+            HeadlessWindow* GetFocusedWindow() const {
+                return mFocused;
+            }
+
+        private:
+            friend class HeadlessWindow;
+            friend class HeadlessWindowInput;
+
+            void FinishPoll();
+            // Moves focus, sending the focus events to both windows
+            void SetFocusedWindow(HeadlessWindow* window);
+
+            ILogStream* mSink = nullptr;
+            IClock* mClock = nullptr;
+            // arrival counter shared by all windows
+            u64 mEventSequence = 0;
+            eastl::vector<eastl::unique_ptr<HeadlessMonitor>> mMonitorsStorage;
+            eastl::vector<IMonitor*> mMonitors;
+            eastl::vector<HeadlessWindow*> mWindows;
+            HeadlessWindow* mFocused = nullptr;
+            InputEventStream mEventStream = {};
+            GamepadInput mGamepadInput = {};
+            eastl::string mClipboard = {};
+            bool bHasClipboardText = false;
+            bool bMonitorsDirty = false;
+            bool bInitialised = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,366 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbKeyboard.hpp"
+#include <EASTL/array.h>
+#include <cstdlib>
+#include <xcb/xcb.h>
+#include <xcb/xproto.h>
+#define XK_MISCELLANY
+#define XK_LATIN1
+#include <X11/keysym.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            // X keycodes are evdev scan codes offset by 8 on every current X server
+            constexpr u8 kEvdevOffset = 8;
+            constexpr KeyCode kUnknownKey = static_cast<KeyCode>(-1);
+
+            constexpr eastl::array<KeyCode, 256> MakeEvdevTable() {
+                eastl::array<KeyCode, 256> table = {};
+                for (KeyCode& key : table) {
+                    key = kUnknownKey;
+                }
+                table[1] = KeyCode::Escape;
+                for (i32 i = 0; i < 9; ++i) {
+                    table[2 + i] = static_cast<KeyCode>(static_cast<i32>(KeyCode::Key1) + i);
+                }
+                table[11] = KeyCode::Key0;
+                table[12] = KeyCode::Minus;
+                table[13] = KeyCode::Equal;
+                table[14] = KeyCode::Backspace;
+                table[15] = KeyCode::Tab;
+                const KeyCode topRow[] = { KeyCode::KeyQ, KeyCode::KeyW, KeyCode::KeyE, KeyCode::KeyR, KeyCode::KeyT,
+                    KeyCode::KeyY, KeyCode::KeyU, KeyCode::KeyI, KeyCode::KeyO, KeyCode::KeyP };
+                for (i32 i = 0; i < 10; ++i) {
+                    table[16 + i] = topRow[i];
+                }
+                table[26] = KeyCode::LeftBracket;
+                table[27] = KeyCode::RightBracket;
+                table[28] = KeyCode::Enter;
+                table[29] = KeyCode::LeftControl;
+                const KeyCode homeRow[] = { KeyCode::KeyA, KeyCode::KeyS, KeyCode::KeyD, KeyCode::KeyF, KeyCode::KeyG,
+                    KeyCode::KeyH, KeyCode::KeyJ, KeyCode::KeyK, KeyCode::KeyL };
+                for (i32 i = 0; i < 9; ++i) {
+                    table[30 + i] = homeRow[i];
+                }
+                table[39] = KeyCode::Semicolon;
+                table[40] = KeyCode::Apostrophe;
+                table[41] = KeyCode::GraveAccent;
+                table[42] = KeyCode::LeftShift;
+                table[43] = KeyCode::Backslash;
+                const KeyCode bottomRow[] = { KeyCode::KeyZ, KeyCode::KeyX, KeyCode::KeyC, KeyCode::KeyV, KeyCode::KeyB,
+                    KeyCode::KeyN, KeyCode::KeyM };
+                for (i32 i = 0; i < 7; ++i) {
+                    table[44 + i] = bottomRow[i];
+                }
+                table[51] = KeyCode::Comma;
+                table[52] = KeyCode::Period;
+                table[53] = KeyCode::Slash;
+                table[54] = KeyCode::RightShift;
+                table[55] = KeyCode::KpMultiply;
+                table[56] = KeyCode::LeftAlt;
+                table[57] = KeyCode::Space;
+                table[58] = KeyCode::CapsLock;
+                for (i32 i = 0; i < 10; ++i) {
+                    table[59 + i] = static_cast<KeyCode>(static_cast<i32>(KeyCode::F1) + i);
+                }
+                table[69] = KeyCode::NumLock;
+                table[70] = KeyCode::ScrollLock;
+                table[71] = KeyCode::Kp7;
+                table[72] = KeyCode::Kp8;
+                table[73] = KeyCode::Kp9;
+                table[74] = KeyCode::KpSubtract;
+                table[75] = KeyCode::Kp4;
+                table[76] = KeyCode::Kp5;
+                table[77] = KeyCode::Kp6;
+                table[78] = KeyCode::KpAdd;
+                table[79] = KeyCode::Kp1;
+                table[80] = KeyCode::Kp2;
+                table[81] = KeyCode::Kp3;
+                table[82] = KeyCode::Kp0;
+                table[83] = KeyCode::KpDecimal;
+                table[86] = KeyCode::World1; // the extra key next to left shift on ISO keyboards
+                table[87] = KeyCode::F11;
+                table[88] = KeyCode::F12;
+                table[96] = KeyCode::KpEnter;
+                table[97] = KeyCode::RightControl;
+                table[98] = KeyCode::KpDivide;
+                table[99] = KeyCode::PrintScreen;
+                table[100] = KeyCode::RightAlt;
+                table[102] = KeyCode::Home;
+                table[103] = KeyCode::Up;
+                table[104] = KeyCode::PageUp;
+                table[105] = KeyCode::Left;
+                table[106] = KeyCode::Right;
+                table[107] = KeyCode::End;
+                table[108] = KeyCode::Down;
+                table[109] = KeyCode::PageDown;
+                table[110] = KeyCode::Insert;
+                table[111] = KeyCode::Delete;
+                table[117] = KeyCode::KpEqual;
+                table[119] = KeyCode::Pause;
+                table[125] = KeyCode::LeftSuper;
+                table[126] = KeyCode::RightSuper;
+                table[127] = KeyCode::Menu;
+                for (i32 i = 0; i < 12; ++i) {
+                    table[183 + i] = static_cast<KeyCode>(static_cast<i32>(KeyCode::F13) + i);
+                }
+                return table;
+            }
+            constexpr eastl::array<KeyCode, 256> kEvdevKeys = MakeEvdevTable();
+
+            KeyCode KeysymToKeyCode(u32 keysym) {
+                if (keysym >= XK_a && keysym <= XK_z) {
+                    return static_cast<KeyCode>(static_cast<i32>(KeyCode::KeyA) + static_cast<i32>(keysym - XK_a));
+                }
+                if (keysym >= XK_A && keysym <= XK_Z) {
+                    return static_cast<KeyCode>(static_cast<i32>(KeyCode::KeyA) + static_cast<i32>(keysym - XK_A));
+                }
+                if (keysym >= XK_0 && keysym <= XK_9) {
+                    return static_cast<KeyCode>(static_cast<i32>(KeyCode::Key0) + static_cast<i32>(keysym - XK_0));
+                }
+                if (keysym >= XK_F1 && keysym <= XK_F25) {
+                    return static_cast<KeyCode>(static_cast<i32>(KeyCode::F1) + static_cast<i32>(keysym - XK_F1));
+                }
+                if (keysym >= XK_KP_0 && keysym <= XK_KP_9) {
+                    return static_cast<KeyCode>(static_cast<i32>(KeyCode::Kp0) + static_cast<i32>(keysym - XK_KP_0));
+                }
+                switch (keysym) {
+                case XK_space:
+                    return KeyCode::Space;
+                case XK_apostrophe:
+                    return KeyCode::Apostrophe;
+                case XK_comma:
+                    return KeyCode::Comma;
+                case XK_minus:
+                    return KeyCode::Minus;
+                case XK_period:
+                    return KeyCode::Period;
+                case XK_slash:
+                    return KeyCode::Slash;
+                case XK_semicolon:
+                    return KeyCode::Semicolon;
+                case XK_equal:
+                    return KeyCode::Equal;
+                case XK_bracketleft:
+                    return KeyCode::LeftBracket;
+                case XK_backslash:
+                    return KeyCode::Backslash;
+                case XK_bracketright:
+                    return KeyCode::RightBracket;
+                case XK_grave:
+                    return KeyCode::GraveAccent;
+                case XK_Escape:
+                    return KeyCode::Escape;
+                case XK_Return:
+                    return KeyCode::Enter;
+                case XK_Tab:
+                    return KeyCode::Tab;
+                case XK_BackSpace:
+                    return KeyCode::Backspace;
+                case XK_Insert:
+                    return KeyCode::Insert;
+                case XK_Delete:
+                    return KeyCode::Delete;
+                case XK_Right:
+                    return KeyCode::Right;
+                case XK_Left:
+                    return KeyCode::Left;
+                case XK_Down:
+                    return KeyCode::Down;
+                case XK_Up:
+                    return KeyCode::Up;
+                case XK_Prior:
+                    return KeyCode::PageUp;
+                case XK_Next:
+                    return KeyCode::PageDown;
+                case XK_Home:
+                    return KeyCode::Home;
+                case XK_End:
+                    return KeyCode::End;
+                case XK_Caps_Lock:
+                    return KeyCode::CapsLock;
+                case XK_Scroll_Lock:
+                    return KeyCode::ScrollLock;
+                case XK_Num_Lock:
+                    return KeyCode::NumLock;
+                case XK_Print:
+                    return KeyCode::PrintScreen;
+                case XK_Pause:
+                    return KeyCode::Pause;
+                case XK_KP_Decimal:
+                    return KeyCode::KpDecimal;
+                case XK_KP_Divide:
+                    return KeyCode::KpDivide;
+                case XK_KP_Multiply:
+                    return KeyCode::KpMultiply;
+                case XK_KP_Subtract:
+                    return KeyCode::KpSubtract;
+                case XK_KP_Add:
+                    return KeyCode::KpAdd;
+                case XK_KP_Enter:
+                    return KeyCode::KpEnter;
+                case XK_KP_Equal:
+                    return KeyCode::KpEqual;
+                case XK_Shift_L:
+                    return KeyCode::LeftShift;
+                case XK_Control_L:
+                    return KeyCode::LeftControl;
+                case XK_Alt_L:
+                case XK_Meta_L:
+                    return KeyCode::LeftAlt;
+                case XK_Super_L:
+                    return KeyCode::LeftSuper;
+                case XK_Shift_R:
+                    return KeyCode::RightShift;
+                case XK_Control_R:
+                    return KeyCode::RightControl;
+                case XK_Alt_R:
+                case XK_Meta_R:
+                case XK_Mode_switch:
+                    return KeyCode::RightAlt;
+                case XK_Super_R:
+                    return KeyCode::RightSuper;
+                case XK_Menu:
+                    return KeyCode::Menu;
+                default:
+                    return kUnknownKey;
+                }
+            }
+
+            u32 KeysymToCodePoint(u32 keysym) {
+                // Latin-1 keysyms are their own code points
+                if ((keysym >= 0x20 && keysym <= 0x7E) || (keysym >= 0xA0 && keysym <= 0xFF)) {
+                    return keysym;
+                }
+                // directly encoded Unicode
+                if ((keysym & 0xFF000000) == 0x01000000) {
+                    return keysym & 0x00FFFFFF;
+                }
+                if (keysym >= XK_KP_0 && keysym <= XK_KP_9) {
+                    return '0' + (keysym - XK_KP_0);
+                }
+                switch (keysym) {
+                case XK_KP_Space:
+                    return ' ';
+                case XK_KP_Equal:
+                    return '=';
+                case XK_KP_Multiply:
+                    return '*';
+                case XK_KP_Add:
+                    return '+';
+                case XK_KP_Separator:
+                    return ',';
+                case XK_KP_Subtract:
+                    return '-';
+                case XK_KP_Decimal:
+                    return '.';
+                case XK_KP_Divide:
+                    return '/';
+                default:
+                    return 0;
+                }
+            }
+
+            bool IsKeypadKeysym(u32 keysym) {
+                return keysym >= XK_KP_Space && keysym <= XK_KP_Equal;
+            }
+        } // namespace
+
+        void XcbKeyboard::Load(xcb_connection_t* connection) {
+            const xcb_setup_t* setup = xcb_get_setup(connection);
+            mMinKeycode = setup->min_keycode;
+            const u8 count = static_cast<u8>(setup->max_keycode - setup->min_keycode + 1);
+            xcb_get_keyboard_mapping_reply_t* reply =
+                xcb_get_keyboard_mapping_reply(connection, xcb_get_keyboard_mapping(connection, setup->min_keycode, count), nullptr);
+            mKeysyms.clear();
+            mKeysymsPerKeycode = 0;
+            if (!reply) {
+                return;
+            }
+            const xcb_keysym_t* keysyms = xcb_get_keyboard_mapping_keysyms(reply);
+            mKeysyms.assign(keysyms, keysyms + xcb_get_keyboard_mapping_keysyms_length(reply));
+            mKeysymsPerKeycode = reply->keysyms_per_keycode;
+            free(reply);
+        }
+
+        KeyCode XcbKeyboard::GetPhysicalKey(u8 keycode) {
+            return keycode >= kEvdevOffset ? kEvdevKeys[keycode - kEvdevOffset] : kUnknownKey;
+        }
+
+        KeyCode XcbKeyboard::GetLogicalKey(u8 keycode) const {
+            const KeyCode key = KeysymToKeyCode(GetKeysym(keycode, 0));
+            return key != kUnknownKey ? key : GetPhysicalKey(keycode);
+        }
+
+        u32 XcbKeyboard::GetCodePoint(u8 keycode, u16 state) const {
+            const u32 lower = GetKeysym(keycode, 0);
+            u32 upper = GetKeysym(keycode, 1);
+            if (upper == XCB_NO_SYMBOL) {
+                upper = lower;
+            }
+            const bool bShift = (state & XCB_MOD_MASK_SHIFT) != 0;
+            const bool bNumLock = (state & XCB_MOD_MASK_2) != 0;
+            const bool bCapsLock = (state & XCB_MOD_MASK_LOCK) != 0;
+            // the core protocol rules for picking a keysym out of the first group
+            u32 keysym;
+            if (bNumLock && IsKeypadKeysym(upper)) {
+                keysym = bShift ? lower : upper;
+            } else {
+                keysym = bShift ? upper : lower;
+                if (bCapsLock && keysym >= XK_a && keysym <= XK_z) {
+                    keysym -= XK_a - XK_A;
+                } else if (bCapsLock && bShift && keysym >= XK_A && keysym <= XK_Z) {
+                    keysym += XK_a - XK_A;
+                }
+            }
+            return KeysymToCodePoint(keysym);
+        }
+
+        InputModifiers::Flags XcbKeyboard::GetModifiers(u16 state) {
+            InputModifiers::Flags mods = 0;
+            if (state & XCB_MOD_MASK_SHIFT)
+                mods |= InputModifiers::Shift;
+            if (state & XCB_MOD_MASK_CONTROL)
+                mods |= InputModifiers::Control;
+            if (state & XCB_MOD_MASK_1)
+                mods |= InputModifiers::Alt;
+            if (state & XCB_MOD_MASK_4)
+                mods |= InputModifiers::Super;
+            if (state & XCB_MOD_MASK_LOCK)
+                mods |= InputModifiers::CapsLock;
+            if (state & XCB_MOD_MASK_2)
+                mods |= InputModifiers::NumLock;
+            return mods;
+        }
+
+        u32 XcbKeyboard::GetKeysym(u8 keycode, u32 index) const {
+            if (keycode < mMinKeycode || index >= mKeysymsPerKeycode) {
+                return XCB_NO_SYMBOL;
+            }
+            const usize offset = static_cast<usize>(keycode - mMinKeycode) * mKeysymsPerKeycode + index;
+            return offset < mKeysyms.size() ? mKeysyms[offset] : XCB_NO_SYMBOL;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
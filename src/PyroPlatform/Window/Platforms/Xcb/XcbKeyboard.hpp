@@ -0,0 +1,54 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+#include <PyroPlatform/Window/Input/Types.hpp>
+
+extern "C" struct xcb_connection_t;
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Core protocol keyboard mapping. Key events carry the layout independent key of the evdev scan
+        // code, same as GLFW. Text covers Latin-1 and Unicode keysyms and there is no input method support.
+        class XcbKeyboard {
+        public:
+            // Fetches the keysym table, the manager calls it again on every keyboard MappingNotify
+            void Load(xcb_connection_t* connection);
+
+            PYRO_NODISCARD static KeyCode GetPhysicalKey(u8 keycode);
+            // Key the current layout puts on the keycode, falls back to the physical key
+            PYRO_NODISCARD KeyCode GetLogicalKey(u8 keycode) const;
+            // Code point the key types with the modifier state of the event, 0 if it types nothing
+            PYRO_NODISCARD u32 GetCodePoint(u8 keycode, u16 state) const;
+            PYRO_NODISCARD static InputModifiers::Flags GetModifiers(u16 state);
+
+        private:
+            u32 GetKeysym(u8 keycode, u32 index) const;
+
+            eastl::vector<u32> mKeysyms = {};
+            u32 mKeysymsPerKeycode = 0;
+            u8 mMinKeycode = 0;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
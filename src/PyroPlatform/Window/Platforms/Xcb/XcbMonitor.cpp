@@ -0,0 +1,200 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbMonitor.hpp"
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+#include <cstdlib>
+#include <xcb/randr.h>
+#include <xcb/xcb.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            VideoMode ToVideoMode(const xcb_randr_mode_info_t& mode, u16 rotation, u32 colorBits) {
+                VideoMode result = {};
+                // the CRTC scans out rotated, the monitor shows the mode sideways
+                if (rotation & (XCB_RANDR_ROTATION_ROTATE_90 | XCB_RANDR_ROTATION_ROTATE_270)) {
+                    result.resolution = Size(mode.height, mode.width);
+                } else {
+                    result.resolution = Size(mode.width, mode.height);
+                }
+                const u64 frame = static_cast<u64>(mode.htotal) * mode.vtotal;
+                result.refreshRate = frame != 0 ? static_cast<u32>((static_cast<u64>(mode.dot_clock) + frame / 2) / frame) : 0;
+                result.redBits = colorBits;
+                result.greenBits = colorBits;
+                result.blueBits = colorBits;
+                return result;
+            }
+
+            const xcb_randr_mode_info_t* FindMode(const xcb_randr_get_screen_resources_current_reply_t* resources, u32 id) {
+                const xcb_randr_mode_info_t* modes = xcb_randr_get_screen_resources_current_modes(resources);
+                const int count = xcb_randr_get_screen_resources_current_modes_length(resources);
+                for (int i = 0; i < count; ++i) {
+                    if (modes[i].id == id) {
+                        return &modes[i];
+                    }
+                }
+                return nullptr;
+            }
+        } // namespace
+
+        XcbMonitor::XcbMonitor(XcbWindowManager* manager, u32 output)
+            : mManager(manager), mOutput(output) {
+        }
+
+        eastl::string XcbMonitor::GetName() const {
+            return mName;
+        }
+
+        Point XcbMonitor::GetPosition() const {
+            return mCache.position;
+        }
+
+        Size XcbMonitor::GetPhysicalSize() const {
+            return mCache.physicalSize;
+        }
+
+        Size XcbMonitor::GetResolution() const {
+            return mCache.currentMode.resolution;
+        }
+
+        Size XcbMonitor::GetWorkArea() const {
+            return mCache.workArea;
+        }
+
+        FSize XcbMonitor::GetContentScale() const {
+            return mCache.contentScale;
+        }
+
+        u32 XcbMonitor::GetRefreshRate() const {
+            return mCache.currentMode.refreshRate;
+        }
+
+        RefreshRate XcbMonitor::GetPreciseRefreshRate() const {
+            return mCache.preciseRefreshRate;
+        }
+
+        VideoMode XcbMonitor::GetCurrentVideoMode() const {
+            return mCache.currentMode;
+        }
+
+        eastl::span<const VideoMode> XcbMonitor::GetVideoModes() const {
+            return { mCache.modes.data(), mCache.modes.size() };
+        }
+
+        bool XcbMonitor::Refresh(const xcb_randr_get_screen_resources_current_reply_t* resources) {
+            xcb_connection_t* connection = mManager->mConnection;
+            const xcb_screen_t* screen = mManager->mScreen;
+            const u32 colorBits = screen->root_depth >= 30 ? 10u : 8u;
+            PropertyCache cache = {};
+
+            if (!resources || mOutput == 0) {
+                mName = "Screen";
+                cache.physicalSize = Size(screen->width_in_millimeters, screen->height_in_millimeters);
+                cache.currentMode.resolution = Size(screen->width_in_pixels, screen->height_in_pixels);
+                cache.currentMode.redBits = colorBits;
+                cache.currentMode.greenBits = colorBits;
+                cache.currentMode.blueBits = colorBits;
+            } else {
+                xcb_randr_get_output_info_reply_t* output =
+                    xcb_randr_get_output_info_reply(connection, xcb_randr_get_output_info(connection, mOutput, resources->config_timestamp), nullptr);
+                if (!output) {
+                    return false;
+                }
+                mName.assign(reinterpret_cast<const char*>(xcb_randr_get_output_info_name(output)),
+                    static_cast<usize>(xcb_randr_get_output_info_name_length(output)));
+                cache.physicalSize = Size(output->mm_width, output->mm_height);
+
+                u16 rotation = XCB_RANDR_ROTATION_ROTATE_0;
+                if (output->crtc != XCB_NONE) {
+                    if (xcb_randr_get_crtc_info_reply_t* crtc =
+                            xcb_randr_get_crtc_info_reply(connection, xcb_randr_get_crtc_info(connection, output->crtc, resources->config_timestamp), nullptr)) {
+                        rotation = crtc->rotation;
+                        cache.position = Point(crtc->x, crtc->y);
+                        if (const xcb_randr_mode_info_t* mode = FindMode(resources, crtc->mode)) {
+                            cache.currentMode = ToVideoMode(*mode, rotation, colorBits);
+                            cache.preciseRefreshRate = RefreshRate::FromModeTimings(mode->dot_clock, mode->htotal, mode->vtotal,
+                                (mode->mode_flags & XCB_RANDR_MODE_FLAG_INTERLACE) != 0, (mode->mode_flags & XCB_RANDR_MODE_FLAG_DOUBLE_SCAN) != 0);
+                        } else {
+                            cache.currentMode.resolution = Size(crtc->width, crtc->height);
+                        }
+                        free(crtc);
+                    }
+                }
+
+                const xcb_randr_mode_t* modeIds = xcb_randr_get_output_info_modes(output);
+                const int modeCount = xcb_randr_get_output_info_modes_length(output);
+                cache.modes.reserve(static_cast<usize>(modeCount));
+                for (int i = 0; i < modeCount; ++i) {
+                    const xcb_randr_mode_info_t* mode = FindMode(resources, modeIds[i]);
+                    // same as GLFW, interlaced modes are not offered
+                    if (mode && !(mode->mode_flags & XCB_RANDR_MODE_FLAG_INTERLACE)) {
+                        cache.modes.push_back(ToVideoMode(*mode, rotation, colorBits));
+                    }
+                }
+                free(output);
+            }
+            if (!cache.preciseRefreshRate.IsValid()) {
+                cache.preciseRefreshRate = RefreshRate::FromHertz(cache.currentMode.refreshRate);
+            }
+            if (cache.modes.empty()) {
+                cache.modes.push_back(cache.currentMode);
+            }
+            eastl::sort(cache.modes.begin(), cache.modes.end(), [](const VideoMode& a, const VideoMode& b) {
+                const u64 areaA = static_cast<u64>(a.resolution.width) * a.resolution.height;
+                const u64 areaB = static_cast<u64>(b.resolution.width) * b.resolution.height;
+                if (areaA != areaB)
+                    return areaA < areaB;
+                if (a.resolution.width != b.resolution.width)
+                    return a.resolution.width < b.resolution.width;
+                return a.refreshRate < b.refreshRate;
+            });
+            cache.modes.erase(eastl::unique(cache.modes.begin(), cache.modes.end()), cache.modes.end());
+            cache.contentScale = mManager->mContentScale;
+
+            // _NET_WORKAREA covers the whole desktop, the monitor's share is the overlap
+            const i32 left = static_cast<i32>(cache.position.x);
+            const i32 top = static_cast<i32>(cache.position.y);
+            const i32 right = left + static_cast<i32>(cache.currentMode.resolution.width);
+            const i32 bottom = top + static_cast<i32>(cache.currentMode.resolution.height);
+            const XcbWindowManager::WorkArea& workArea = mManager->mWorkArea;
+            if (workArea.width > 0 && workArea.height > 0) {
+                const i32 width = eastl::min(right, workArea.x + workArea.width) - eastl::max(left, workArea.x);
+                const i32 height = eastl::min(bottom, workArea.y + workArea.height) - eastl::max(top, workArea.y);
+                cache.workArea = Size(static_cast<u32>(eastl::max(width, 0)), static_cast<u32>(eastl::max(height, 0)));
+            } else {
+                cache.workArea = cache.currentMode.resolution;
+            }
+
+            const bool bChanged = cache.position.x != mCache.position.x || cache.position.y != mCache.position.y ||
+                                  cache.physicalSize.width != mCache.physicalSize.width || cache.physicalSize.height != mCache.physicalSize.height ||
+                                  cache.workArea.width != mCache.workArea.width || cache.workArea.height != mCache.workArea.height ||
+                                  cache.contentScale.width != mCache.contentScale.width || cache.contentScale.height != mCache.contentScale.height ||
+                                  cache.currentMode != mCache.currentMode || cache.preciseRefreshRate != mCache.preciseRefreshRate || cache.modes.size() != mCache.modes.size() ||
+                                  !eastl::equal(cache.modes.begin(), cache.modes.end(), mCache.modes.begin());
+            mCache = eastl::move(cache);
+            return bChanged;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IMonitor.hpp>
+
+extern "C" struct xcb_randr_get_screen_resources_current_reply_t;
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class XcbWindowManager;
+        // One RandR output driven by a CRTC. Without RandR the whole X screen is a single monitor.
+        class XcbMonitor : public IMonitor, DeleteCopy, DeleteMove {
+        public:
+            XcbMonitor(XcbWindowManager* manager, u32 output);
+            ~XcbMonitor() = default;
+
+            eastl::string GetName() const override;
+            Point GetPosition() const override;
+            Size GetPhysicalSize() const override;
+            Size GetResolution() const override;
+            Size GetWorkArea() const override;
+            FSize GetContentScale() const override;
+            u32 GetRefreshRate() const override;
+            RefreshRate GetPreciseRefreshRate() const override;
+            VideoMode GetCurrentVideoMode() const override;
+            eastl::span<const VideoMode> GetVideoModes() const override;
+
+            // Re-reads the output, the manager passes the screen resources it already fetched for
+            // every monitor (null without RandR). Returns true if anything changed.
+            bool Refresh(const xcb_randr_get_screen_resources_current_reply_t* resources);
+
+            // RandR output id, 0 for the screen fallback
+            u32 GetOutput() const {
+                return mOutput;
+            }
+
+        private:
+            struct PropertyCache {
+                Point position = {};
+                Size physicalSize = {};
+                Size workArea = {};
+                FSize contentScale = {};
+                VideoMode currentMode = {};
+                RefreshRate preciseRefreshRate = {};
+                eastl::vector<VideoMode> modes = {};
+            };
+
+            XcbWindowManager* mManager = nullptr;
+            u32 mOutput = 0;
+            eastl::string mName;
+            PropertyCache mCache = {};
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
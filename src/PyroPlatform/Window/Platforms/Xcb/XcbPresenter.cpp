@@ -0,0 +1,219 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbPresenter.hpp"
+#include <EASTL/algorithm.h>
+#include <PyroCommon/Logger.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <xcb/shm.h>
+#include <xcb/xcb.h>
+
+#include <libassert/assert.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        XcbPresenter::XcbPresenter(XcbWindowManager* manager, u32 window)
+            : mManager(manager), mWindow(window), mDepth(manager->mScreen->root_depth), bUseShm(manager->bHasShm) {
+            xcb_connection_t* connection = manager->mConnection;
+            const xcb_setup_t* setup = xcb_get_setup(connection);
+            // the pixels are handed over as they are, the server has to store them the same way
+            u8 bitsPerPixel = 0;
+            for (xcb_format_iterator_t it = xcb_setup_pixmap_formats_iterator(setup); it.rem > 0; xcb_format_next(&it)) {
+                if (it.data->depth == mDepth) {
+                    bitsPerPixel = it.data->bits_per_pixel;
+                }
+            }
+            const u8 byteOrder = std::endian::native == std::endian::little ? XCB_IMAGE_ORDER_LSB_FIRST : XCB_IMAGE_ORDER_MSB_FIRST;
+            bSupported = (mDepth == 24 || mDepth == 32) && bitsPerPixel == 32 && setup->image_byte_order == byteOrder;
+            if (!bSupported) {
+                Logger::Error(manager->mSink, "Cannot present pixels! Reason: the screen is {} bit with {} bits per pixel, only 32 bit pixels in native byte order are supported",
+                    mDepth, bitsPerPixel);
+                return;
+            }
+            mGc = xcb_generate_id(connection);
+            const u32 graphicsExposures = 0;
+            xcb_create_gc(connection, mGc, mWindow, XCB_GC_GRAPHICS_EXPOSURES, &graphicsExposures);
+        }
+
+        XcbPresenter::~XcbPresenter() {
+            for (Segment& segment : mSegments) {
+                Release(segment);
+            }
+            if (mGc != 0) {
+                xcb_free_gc(mManager->mConnection, mGc);
+            }
+        }
+
+        bool XcbPresenter::Present(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            if (!bSupported) {
+                return false;
+            }
+            // coordinates in the protocol are 16 bit
+            ASSERT(size.width <= 0x7FFF && size.height <= 0x7FFF, "Image is larger than X11 can address!");
+            mRects.clear();
+            const WindowRect whole = { 0, 0, size.width, size.height };
+            for (const WindowRect& dirty : dirtyRects.empty() ? eastl::span<const WindowRect>(&whole, 1) : dirtyRects) {
+                const WindowRect rect = dirty.Clipped(size);
+                if (!rect.IsEmpty()) {
+                    mRects.push_back(rect);
+                }
+            }
+            if (mRects.empty()) {
+                return true;
+            }
+
+            xcb_connection_t* connection = mManager->mConnection;
+            Segment* segment = bUseShm ? AcquireSegment(static_cast<usize>(size.width) * size.height * 4) : nullptr;
+            if (!segment) {
+                for (const WindowRect& rect : mRects) {
+                    PutImage(pixels, stride, rect);
+                }
+                xcb_flush(connection);
+                return true;
+            }
+            // the segment is laid out like the image, tightly packed
+            const usize rowBytes = static_cast<usize>(size.width) * 4;
+            for (usize i = 0; i < mRects.size(); ++i) {
+                const WindowRect& rect = mRects[i];
+                for (u32 row = 0; row < rect.height; ++row) {
+                    const usize y = static_cast<usize>(rect.y) + row;
+                    memcpy(segment->data + y * rowBytes + static_cast<usize>(rect.x) * 4, &pixels[y * stride + static_cast<usize>(rect.x) * 4], rect.width * 4);
+                }
+                // only the last upload asks for a completion, the server handles them in order
+                const bool bLast = i + 1 == mRects.size();
+                const xcb_void_cookie_t cookie = xcb_shm_put_image(connection, mWindow, mGc, static_cast<u16>(size.width), static_cast<u16>(size.height),
+                    static_cast<u16>(rect.x), static_cast<u16>(rect.y), static_cast<u16>(rect.width), static_cast<u16>(rect.height),
+                    static_cast<i16>(rect.x), static_cast<i16>(rect.y), mDepth, XCB_IMAGE_FORMAT_Z_PIXMAP, bLast ? 1 : 0, segment->id, 0);
+                if (bLast) {
+                    segment->sequence = cookie.sequence;
+                    segment->bBusy = true;
+                }
+            }
+            xcb_flush(connection);
+            return true;
+        }
+
+        void XcbPresenter::OnCompletion(u32 segment, u16 sequence) {
+            for (Segment& candidate : mSegments) {
+                // completions of uploads from before a resize or a sync no longer match
+                if (candidate.id == segment && candidate.bBusy && static_cast<u16>(candidate.sequence) == sequence) {
+                    candidate.bBusy = false;
+                }
+            }
+        }
+
+        XcbPresenter::Segment* XcbPresenter::AcquireSegment(usize bytes) {
+            Segment* segment = nullptr;
+            for (u32 i = 0; i < 2 && !segment; ++i) {
+                Segment& candidate = mSegments[(mNextSegment + i) % 2];
+                if (!candidate.bBusy) {
+                    segment = &candidate;
+                    mNextSegment = (mNextSegment + i + 1) % 2;
+                }
+            }
+            if (!segment) {
+                // presenting faster than the server draws, wait until it is through both. It handles
+                // requests in order, so once a reply is back every earlier upload is done.
+                xcb_connection_t* connection = mManager->mConnection;
+                free(xcb_get_input_focus_reply(connection, xcb_get_input_focus(connection), nullptr));
+                for (Segment& candidate : mSegments) {
+                    candidate.bBusy = false;
+                }
+                segment = &mSegments[mNextSegment];
+                mNextSegment = (mNextSegment + 1) % 2;
+            }
+            if (segment->capacity < bytes && !Allocate(*segment, bytes)) {
+                Logger::Info(mManager->mSink, "MIT-SHM is not usable with this display, presenting through PutImage");
+                for (Segment& candidate : mSegments) {
+                    Release(candidate);
+                }
+                bUseShm = false;
+                return nullptr;
+            }
+            return segment;
+        }
+
+        bool XcbPresenter::Allocate(Segment& segment, usize bytes) {
+            Release(segment);
+            const i32 shmid = shmget(IPC_PRIVATE, bytes, IPC_CREAT | 0600);
+            if (shmid < 0) {
+                return false;
+            }
+            void* data = shmat(shmid, nullptr, 0);
+            if (data == reinterpret_cast<void*>(-1)) {
+                shmctl(shmid, IPC_RMID, nullptr);
+                return false;
+            }
+            xcb_connection_t* connection = mManager->mConnection;
+            const u32 id = xcb_generate_id(connection);
+            // a server on another machine can't attach, this is where that shows
+            xcb_generic_error_t* error = xcb_request_check(connection, xcb_shm_attach_checked(connection, id, static_cast<u32>(shmid), 1));
+            // marked for removal right away, it goes once both sides detached, even after a crash
+            shmctl(shmid, IPC_RMID, nullptr);
+            if (error) {
+                free(error);
+                shmdt(data);
+                return false;
+            }
+            segment.data = static_cast<u8*>(data);
+            segment.capacity = bytes;
+            segment.shmid = shmid;
+            segment.id = id;
+            segment.bBusy = false;
+            return true;
+        }
+
+        void XcbPresenter::Release(Segment& segment) {
+            if (!segment.data) {
+                return;
+            }
+            // the server detaches after the uploads before it, the memory stays valid for those
+            xcb_shm_detach(mManager->mConnection, segment.id);
+            shmdt(segment.data);
+            segment = {};
+        }
+
+        void XcbPresenter::PutImage(eastl::span<const u8> pixels, u32 stride, const WindowRect& rect) {
+            xcb_connection_t* connection = mManager->mConnection;
+            // large rectangles are split into bands of rows that fit in a request
+            const usize rowBytes = static_cast<usize>(rect.width) * 4;
+            const usize maxBytes = static_cast<usize>(xcb_get_maximum_request_length(connection)) * 4 - sizeof(xcb_put_image_request_t);
+            const u32 bandRows = static_cast<u32>(eastl::max<usize>(maxBytes / rowBytes, 1));
+            for (u32 band = 0; band < rect.height; band += bandRows) {
+                const u32 rows = eastl::min(bandRows, rect.height - band);
+                mRows.resize(rowBytes * rows);
+                for (u32 row = 0; row < rows; ++row) {
+                    const usize y = static_cast<usize>(rect.y) + band + row;
+                    memcpy(&mRows[row * rowBytes], &pixels[y * stride + static_cast<usize>(rect.x) * 4], rowBytes);
+                }
+                xcb_put_image(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, mWindow, mGc, static_cast<u16>(rect.width), static_cast<u16>(rows),
+                    static_cast<i16>(rect.x), static_cast<i16>(rect.y + band), 0, mDepth, static_cast<u32>(mRows.size()), mRows.data());
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
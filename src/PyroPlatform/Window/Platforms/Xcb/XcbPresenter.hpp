@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class XcbWindowManager;
+        // Uploads CPU rendered pixels to a window. With MIT-SHM the image is written to one of two
+        // shared memory segments and the server reads it from there, nothing goes through the socket.
+        // A frame is written to the other segment while the server may still read the last one, the
+        // ShmCompletion event hands a segment back. Remote displays fall back to PutImage requests.
+        class XcbPresenter : DeleteCopy, DeleteMove {
+        public:
+            XcbPresenter(XcbWindowManager* manager, u32 window);
+            ~XcbPresenter();
+
+            bool Present(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects);
+            // ShmCompletion for a segment, sequence is the one of the ShmPutImage it answers
+            void OnCompletion(u32 segment, u16 sequence);
+
+        private:
+            struct Segment {
+                u8* data = nullptr;
+                usize capacity = 0;
+                i32 shmid = -1;
+                u32 id = 0;
+                // sequence of the last ShmPutImage from this segment, busy until its completion arrives
+                u32 sequence = 0;
+                bool bBusy = false;
+            };
+
+            Segment* AcquireSegment(usize bytes);
+            bool Allocate(Segment& segment, usize bytes);
+            void Release(Segment& segment);
+            void PutImage(eastl::span<const u8> pixels, u32 stride, const WindowRect& rect);
+
+            XcbWindowManager* mManager = nullptr;
+            u32 mWindow = 0;
+            u32 mGc = 0;
+            u8 mDepth = 0;
+            Segment mSegments[2] = {};
+            u32 mNextSegment = 0;
+            eastl::vector<WindowRect> mRects = {};
+            // rows of a PutImage request, the fallback path has to copy them out of the image
+            eastl::vector<u8> mRows = {};
+            bool bSupported = false;
+            bool bUseShm = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
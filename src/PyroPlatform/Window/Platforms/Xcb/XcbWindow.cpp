@@ -0,0 +1,726 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbWindow.hpp"
+#include <EASTL/algorithm.h>
+#include <PyroPlatform/Window/IMonitor.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbCursor.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbPresenter.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowInput.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+#include <cstdlib>
+#include <xcb/shape.h>
+#include <xcb/xcb.h>
+#include <xcb/xinput.h>
+
+#include <libassert/assert.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            // ICCCM WM_STATE and WM_CHANGE_STATE values
+            constexpr u32 kNormalState = 1;
+            constexpr u32 kIconicState = 3;
+            // WM_HINTS flags
+            constexpr u32 kInputHint = 1;
+            constexpr u32 kStateHint = 2;
+            // WM_NORMAL_HINTS flags
+            constexpr u32 kMinSizeHint = 16;
+            constexpr u32 kMaxSizeHint = 32;
+            // _MOTIF_WM_HINTS flag for the decorations field
+            constexpr u32 kMotifDecorations = 2;
+            // _NET_WM_STATE actions
+            constexpr u32 kNetWmStateRemove = 0;
+            constexpr u32 kNetWmStateAdd = 1;
+
+            // true if the _NET_WM_STATE reply lists either state, the atoms are never 0
+            bool HasNetWmState(xcb_get_property_reply_t* reply, u32 first, u32 second = 0) {
+                if (!reply || reply->format != 32) {
+                    return false;
+                }
+                const u32* states = static_cast<const u32*>(xcb_get_property_value(reply));
+                const int count = xcb_get_property_value_length(reply) / 4;
+                for (int i = 0; i < count; ++i) {
+                    if (states[i] == first || (second != 0 && states[i] == second)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool ReadIconified(xcb_get_property_reply_t* reply) {
+                if (!reply || reply->format != 32 || xcb_get_property_value_length(reply) < 4) {
+                    return false;
+                }
+                return *static_cast<const u32*>(xcb_get_property_value(reply)) == kIconicState;
+            }
+        } // namespace
+
+        XcbWindow::XcbWindow(XcbWindowManager* manager, const WindowInfo& info)
+            : mManager(manager), bResizable(static_cast<bool>(info.flags & WindowCreateBits::RESIZABLE)) {
+            xcb_connection_t* connection = manager->mConnection;
+            const XcbWindowManager::Atoms& atoms = manager->mAtoms;
+            mInput = new XcbWindowInput(this, manager);
+            mParent = manager->mRoot;
+            mCache.contentScale = manager->mContentScale;
+            mCache.title = info.title;
+            mCache.bPassthrough = static_cast<bool>(info.flags & WindowCreateBits::PASSTHROUGH);
+            mCache.bTopMost = static_cast<bool>(info.flags & WindowCreateBits::TOP_MOST);
+
+            // X11 has no framebuffer scale, like GLFW_SCALE_TO_MONITOR the window itself is made larger
+            Size size(eastl::max(info.width, 1u), eastl::max(info.height, 1u));
+            if (info.flags & WindowCreateBits::HIGH_DPI) {
+                size = Size(static_cast<u32>(static_cast<f32>(size.width) * mCache.contentScale.width),
+                    static_cast<u32>(static_cast<f32>(size.height) * mCache.contentScale.height));
+            }
+            mCache.size = size;
+            mCache.framebufferSize = size;
+
+            u32 eventMask = XCB_EVENT_MASK_KEY_PRESS | XCB_EVENT_MASK_KEY_RELEASE | XCB_EVENT_MASK_BUTTON_PRESS |
+                            XCB_EVENT_MASK_BUTTON_RELEASE | XCB_EVENT_MASK_ENTER_WINDOW | XCB_EVENT_MASK_LEAVE_WINDOW |
+                            XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_STRUCTURE_NOTIFY | XCB_EVENT_MASK_FOCUS_CHANGE |
+                            XCB_EVENT_MASK_PROPERTY_CHANGE | XCB_EVENT_MASK_VISIBILITY_CHANGE;
+            if (!manager->bHasXInput) {
+                eventMask |= XCB_EVENT_MASK_POINTER_MOTION;
+            }
+            const u32 values[] = { 0, eventMask };
+            mWindow = xcb_generate_id(connection);
+            xcb_create_window(connection, XCB_COPY_FROM_PARENT, mWindow, manager->mRoot, 0, 0, static_cast<u16>(size.width),
+                static_cast<u16>(size.height), 0, XCB_WINDOW_CLASS_INPUT_OUTPUT, manager->mScreen->root_visual,
+                XCB_CW_BORDER_PIXEL | XCB_CW_EVENT_MASK, values);
+            if (manager->bHasXInput) {
+                // the mask bits follow the header, mask_len counts them in 32-bit words
+                struct {
+                    xcb_input_event_mask_t header;
+                    u32 mask;
+                } mask = { { XCB_INPUT_DEVICE_ALL_MASTER, 1 }, XCB_INPUT_XI_EVENT_MASK_MOTION };
+                xcb_input_xi_select_events(connection, mWindow, 1, &mask.header);
+            }
+
+            const u32 protocols[] = { atoms.wmDeleteWindow, atoms.netWmPing };
+            xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, atoms.wmProtocols, XCB_ATOM_ATOM, 32, 2, protocols);
+            const u32 hints[9] = { kInputHint | kStateHint, 1, info.initialState == WindowState::Minimized ? kIconicState : kNormalState };
+            xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, XCB_ATOM_WM_HINTS, XCB_ATOM_WM_HINTS, 32, 9, hints);
+            if (!(info.flags & WindowCreateBits::DECORATED)) {
+                const u32 motifHints[5] = { kMotifDecorations, 0, 0, 0, 0 };
+                xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, atoms.motifWmHints, atoms.motifWmHints, 32, 5, motifHints);
+            }
+            UpdateSizeHints(size);
+            SetTitle(info.title);
+
+            // before mapping the window manager reads the initial state straight from the property
+            u32 states[3] = {};
+            u32 stateCount = 0;
+            if (mCache.bTopMost) {
+                states[stateCount++] = atoms.netWmStateAbove;
+            }
+            if (info.initialState == WindowState::Maximized) {
+                states[stateCount++] = atoms.netWmStateMaximizedVert;
+                states[stateCount++] = atoms.netWmStateMaximizedHorz;
+            }
+            if (stateCount > 0) {
+                xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, atoms.netWmState, XCB_ATOM_ATOM, 32, stateCount, states);
+            }
+            if (mCache.bPassthrough) {
+                SetPassthrough(true);
+            }
+            if (info.flags & WindowCreateBits::VISIBLE) {
+                Show();
+                if (info.flags & WindowCreateBits::FOCUSED) {
+                    Focus();
+                }
+            }
+        }
+        XcbWindow::~XcbWindow() {
+            xcb_connection_t* connection = mManager->mConnection;
+            Ungrab();
+            if (mPending.bPosition) {
+                xcb_discard_reply(connection, mPending.position);
+            }
+            if (mPending.bNetWmState) {
+                xcb_discard_reply(connection, mPending.netWmState);
+            }
+            if (mPending.bWmState) {
+                xcb_discard_reply(connection, mPending.wmState);
+            }
+            delete mPresenter;
+            xcb_destroy_window(connection, mWindow);
+            xcb_flush(connection);
+            delete mInput;
+        }
+
+        Size XcbWindow::GetSize() const {
+            return mCache.size;
+        }
+
+        Point XcbWindow::GetPosition() const {
+            return mCache.position;
+        }
+
+        Point XcbWindow::GetCursorPosition() const {
+            return mCache.cursorPosition;
+        }
+
+        f32 XcbWindow::GetOpacity() const {
+            return mCache.opacity;
+        }
+
+        void XcbWindow::SetSize(Size size) {
+            if (!bResizable) {
+                UpdateSizeHints(size);
+            }
+            const u32 values[] = { size.width, size.height };
+            xcb_configure_window(mManager->mConnection, mWindow, XCB_CONFIG_WINDOW_WIDTH | XCB_CONFIG_WINDOW_HEIGHT, values);
+        }
+
+        void XcbWindow::SetPosition(Point point) {
+            const u32 values[] = { static_cast<u32>(point.x), static_cast<u32>(point.y) };
+            xcb_configure_window(mManager->mConnection, mWindow, XCB_CONFIG_WINDOW_X | XCB_CONFIG_WINDOW_Y, values);
+        }
+
+        void XcbWindow::SetCursorPosition(Point point) {
+            if (bGrabbed) {
+                // the pointer stays parked, only the position the application sees moves
+                mVirtualCursorX = static_cast<f64>(point.x);
+                mVirtualCursorY = static_cast<f64>(point.y);
+                mCache.cursorPosition = point;
+                return;
+            }
+            xcb_warp_pointer(mManager->mConnection, XCB_NONE, mWindow, 0, 0, 0, 0, static_cast<i16>(point.x), static_cast<i16>(point.y));
+        }
+
+        void XcbWindow::SetCursorVisible(bool bVisible) {
+            SetCursorMode(bVisible ? CursorMode::Normal : CursorMode::Hidden);
+        }
+
+        void XcbWindow::SetCursorLockedToWindow(bool bLocked) {
+            SetCursorMode(bLocked ? CursorMode::Locked : CursorMode::Normal);
+        }
+
+        void XcbWindow::SetOpacity(f32 opacity) {
+            xcb_connection_t* connection = mManager->mConnection;
+            mCache.opacity = eastl::clamp(opacity, 0.0f, 1.0f);
+            if (mCache.opacity >= 1.0f) {
+                // compositors treat a missing property as opaque and can skip blending the window
+                xcb_delete_property(connection, mWindow, mManager->mAtoms.netWmWindowOpacity);
+                return;
+            }
+            const u32 value = static_cast<u32>(static_cast<f64>(mCache.opacity) * 0xFFFFFFFFu);
+            xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, mManager->mAtoms.netWmWindowOpacity, XCB_ATOM_CARDINAL, 32, 1, &value);
+        }
+
+        void XcbWindow::SetCursor(ICursor* cursor) {
+            mCursor = cursor;
+            if (mCache.cursorMode == CursorMode::Normal) {
+                ApplyCursorMode();
+            }
+        }
+
+        void XcbWindow::SetFullscreen(IMonitor* monitor) {
+            mCache.fullscreen = monitor;
+            if (monitor) {
+                // the window manager fills the monitor the window is on
+                SetPosition(monitor->GetPosition());
+            }
+            ChangeNetWmState(monitor ? kNetWmStateAdd : kNetWmStateRemove, mManager->mAtoms.netWmStateFullscreen);
+        }
+
+        void XcbWindow::SetWindowState(WindowState state) {
+            const XcbWindowManager::Atoms& atoms = mManager->mAtoms;
+            switch (state) {
+            case WindowState::Minimized:
+                mManager->SendRootMessage(mWindow, atoms.wmChangeState, kIconicState);
+                break;
+            case WindowState::Maximized:
+                if (mCache.bIconified) {
+                    xcb_map_window(mManager->mConnection, mWindow);
+                }
+                ChangeNetWmState(kNetWmStateAdd, atoms.netWmStateMaximizedVert, atoms.netWmStateMaximizedHorz);
+                break;
+            case WindowState::Normal:
+                // restoring leaves the minimised state first, same as glfwRestoreWindow
+                if (mCache.bIconified) {
+                    xcb_map_window(mManager->mConnection, mWindow);
+                } else if (mCache.bMaximized) {
+                    ChangeNetWmState(kNetWmStateRemove, atoms.netWmStateMaximizedVert, atoms.netWmStateMaximizedHorz);
+                }
+                break;
+            }
+        }
+
+        WindowState XcbWindow::GetWindowState() const {
+            if (mCache.bIconified)
+                return WindowState::Minimized;
+            if (mCache.bMaximized)
+                return WindowState::Maximized;
+            return WindowState::Normal;
+        }
+
+        eastl::string XcbWindow::GetTitle() const {
+            return mCache.title;
+        }
+
+        void XcbWindow::SetTitle(eastl::string_view title) {
+            xcb_connection_t* connection = mManager->mConnection;
+            mCache.title.assign(title.data(), title.size());
+            // WM_NAME for old window managers, _NET_WM_NAME is the UTF-8 one everything current reads
+            xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, XCB_ATOM_WM_NAME, XCB_ATOM_STRING, 8,
+                static_cast<u32>(title.size()), title.data());
+            xcb_change_property(connection, XCB_PROP_MODE_REPLACE, mWindow, mManager->mAtoms.netWmName, mManager->mAtoms.utf8String, 8,
+                static_cast<u32>(title.size()), title.data());
+        }
+
+        Size XcbWindow::GetFramebufferSize() const {
+            return mCache.framebufferSize;
+        }
+
+        f32 XcbWindow::GetDPIScale() const {
+            if (mCache.size.width == 0) {
+                return 1.0f;
+            }
+            return static_cast<f32>(mCache.framebufferSize.width) / static_cast<f32>(mCache.size.width);
+        }
+
+        FSize XcbWindow::GetContentScale() const {
+            return mCache.contentScale;
+        }
+
+        CursorMode XcbWindow::GetCursorMode() const {
+            return mCache.cursorMode;
+        }
+
+        bool XcbWindow::IsStickyKeysEnabled() const {
+            return mCache.bStickyKeys;
+        }
+
+        bool XcbWindow::IsStickyMouseButtonsEnabled() const {
+            return mCache.bStickyMouseButtons;
+        }
+
+        bool XcbWindow::IsRawMouseMotionEnabled() const {
+            return mCache.bRawMouseMotion;
+        }
+
+        void XcbWindow::SetCursorMode(CursorMode mode) {
+            if (mode == mCache.cursorMode) {
+                return;
+            }
+            const bool bWasLocked = mCache.cursorMode == CursorMode::Locked;
+            if (mode == CursorMode::Locked) {
+                mRestoreCursor = mCache.cursorPosition;
+                mVirtualCursorX = static_cast<f64>(mCache.cursorPosition.x);
+                mVirtualCursorY = static_cast<f64>(mCache.cursorPosition.y);
+            }
+            mCache.cursorMode = mode;
+            ApplyCursorMode();
+            if (bWasLocked) {
+                // put the pointer back where it was locked, like GLFW
+                SetCursorPosition(mRestoreCursor);
+            }
+        }
+
+        void XcbWindow::SetStickyKeysEnabled(bool bEnabled) {
+            mCache.bStickyKeys = bEnabled;
+        }
+
+        void XcbWindow::SetStickyMouseButtonsEnabled(bool bEnabled) {
+            mCache.bStickyMouseButtons = bEnabled;
+        }
+
+        void XcbWindow::SetRawMouseMotionEnabled(bool bEnabled) {
+            mCache.bRawMouseMotion = bEnabled;
+            mManager->UpdateRawMotionSelection();
+        }
+
+        void XcbWindow::Show() {
+            xcb_map_window(mManager->mConnection, mWindow);
+            mCache.bVisible = true;
+        }
+
+        void XcbWindow::Hide() {
+            xcb_unmap_window(mManager->mConnection, mWindow);
+            mCache.bVisible = false;
+        }
+
+        void XcbWindow::Close() {
+            mCache.bShouldClose = true;
+        }
+
+        void XcbWindow::CancelClose() {
+            mCache.bShouldClose = false;
+        }
+
+        void XcbWindow::Focus() {
+            xcb_connection_t* connection = mManager->mConnection;
+            if (mManager->IsWmSupported(mManager->mAtoms.netActiveWindow)) {
+                // source 1, a request from a normal application
+                mManager->SendRootMessage(mWindow, mManager->mAtoms.netActiveWindow, 1, XCB_CURRENT_TIME);
+            } else if (mCache.bVisible && !mCache.bIconified) {
+                // no window manager to ask, take the focus directly
+                const u32 stackMode = XCB_STACK_MODE_ABOVE;
+                xcb_configure_window(connection, mWindow, XCB_CONFIG_WINDOW_STACK_MODE, &stackMode);
+                xcb_set_input_focus(connection, XCB_INPUT_FOCUS_PARENT, mWindow, XCB_CURRENT_TIME);
+            }
+        }
+
+        void XcbWindow::SetPassthrough(bool bPassthrough) {
+            mCache.bPassthrough = bPassthrough;
+            if (!mManager->bHasShape) {
+                return;
+            }
+            if (bPassthrough) {
+                // an empty input shape, clicks land on whatever is below
+                xcb_shape_rectangles(mManager->mConnection, XCB_SHAPE_SO_SET, XCB_SHAPE_SK_INPUT, XCB_CLIP_ORDERING_UNSORTED, mWindow,
+                    0, 0, 0, nullptr);
+            } else {
+                xcb_shape_mask(mManager->mConnection, XCB_SHAPE_SO_SET, XCB_SHAPE_SK_INPUT, mWindow, 0, 0, XCB_NONE);
+            }
+        }
+
+        void XcbWindow::SetTopMost(bool bTopMost) {
+            mCache.bTopMost = bTopMost;
+            ChangeNetWmState(bTopMost ? kNetWmStateAdd : kNetWmStateRemove, mManager->mAtoms.netWmStateAbove);
+        }
+
+        void XcbWindow::RequestAttention() {
+            ChangeNetWmState(kNetWmStateAdd, mManager->mAtoms.netWmStateDemandsAttention);
+        }
+
+        bool XcbWindow::IsVisible() const {
+            return mCache.bVisible;
+        }
+
+        bool XcbWindow::ShouldClose() const {
+            return mCache.bShouldClose;
+        }
+
+        bool XcbWindow::IsFocused() const {
+            return mCache.bFocused;
+        }
+
+        bool XcbWindow::IsHovered() const {
+            return mCache.bHovered;
+        }
+
+        WindowVisibilityState XcbWindow::GetVisibilityState() const {
+            return mCache.visibility;
+        }
+
+        void XcbWindow::Refresh() {
+            xcb_connection_t* connection = mManager->mConnection;
+            const XcbWindowManager::Atoms& atoms = mManager->mAtoms;
+            const xcb_get_geometry_cookie_t geometryCookie = xcb_get_geometry(connection, mWindow);
+            const xcb_translate_coordinates_cookie_t positionCookie = xcb_translate_coordinates(connection, mWindow, mManager->mRoot, 0, 0);
+            const xcb_query_pointer_cookie_t pointerCookie = xcb_query_pointer(connection, mWindow);
+            const xcb_get_input_focus_cookie_t focusCookie = xcb_get_input_focus(connection);
+            const xcb_get_window_attributes_cookie_t attributesCookie = xcb_get_window_attributes(connection, mWindow);
+            const xcb_get_property_cookie_t netWmStateCookie = xcb_get_property(connection, 0, mWindow, atoms.netWmState, XCB_ATOM_ATOM, 0, 64);
+            const xcb_get_property_cookie_t wmStateCookie = xcb_get_property(connection, 0, mWindow, atoms.wmState, atoms.wmState, 0, 2);
+
+            if (xcb_get_geometry_reply_t* geometry = xcb_get_geometry_reply(connection, geometryCookie, nullptr)) {
+                mCache.size = Size(geometry->width, geometry->height);
+                mCache.framebufferSize = mCache.size;
+                free(geometry);
+            }
+            if (xcb_translate_coordinates_reply_t* position = xcb_translate_coordinates_reply(connection, positionCookie, nullptr)) {
+                mCache.position = Point(position->dst_x, position->dst_y);
+                free(position);
+            }
+            if (xcb_query_pointer_reply_t* pointer = xcb_query_pointer_reply(connection, pointerCookie, nullptr)) {
+                if (!bGrabbed) {
+                    mCache.cursorPosition = ToCursorPoint(pointer->win_x, pointer->win_y);
+                }
+                mCache.bHovered = pointer->same_screen && pointer->win_x >= 0 && pointer->win_y >= 0 &&
+                                  pointer->win_x < static_cast<i32>(mCache.size.width) && pointer->win_y < static_cast<i32>(mCache.size.height);
+                free(pointer);
+            }
+            if (xcb_get_input_focus_reply_t* focus = xcb_get_input_focus_reply(connection, focusCookie, nullptr)) {
+                mCache.bFocused = focus->focus == mWindow;
+                free(focus);
+            }
+            if (xcb_get_window_attributes_reply_t* attributes = xcb_get_window_attributes_reply(connection, attributesCookie, nullptr)) {
+                mCache.bVisible = attributes->map_state == XCB_MAP_STATE_VIEWABLE;
+                free(attributes);
+            }
+            xcb_get_property_reply_t* netWmState = xcb_get_property_reply(connection, netWmStateCookie, nullptr);
+            // same as GLFW, either direction counts
+            mCache.bMaximized = HasNetWmState(netWmState, atoms.netWmStateMaximizedVert, atoms.netWmStateMaximizedHorz);
+            mCache.bHidden = HasNetWmState(netWmState, atoms.netWmStateHidden);
+            free(netWmState);
+            xcb_get_property_reply_t* wmState = xcb_get_property_reply(connection, wmStateCookie, nullptr);
+            mCache.bIconified = ReadIconified(wmState);
+            free(wmState);
+            mCache.contentScale = mManager->mContentScale;
+            mCache.visibility = ComputeVisibility();
+        }
+
+        IWindowInput* XcbWindow::GetInputHandler() {
+            return mInput;
+        }
+
+        bool XcbWindow::PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects) {
+            ASSERT(stride >= size.width * 4, "Stride is shorter than a row!");
+            ASSERT(size.height == 0 || pixels.size() >= static_cast<usize>(stride) * (size.height - 1) + size.width * 4, "Pixel buffer is smaller than the image!");
+            if (!mPresenter) {
+                mPresenter = new XcbPresenter(mManager, mWindow);
+            }
+            return mPresenter->Present(pixels, size, stride, dirtyRects);
+        }
+
+        NativeHandle XcbWindow::GetNativeWindow() const {
+            return reinterpret_cast<NativeHandle>(static_cast<uintptr_t>(mWindow));
+        }
+
+        NativeHandle XcbWindow::GetNativeInstance() const {
+            return reinterpret_cast<NativeHandle>(mManager->mConnection);
+        }
+
+        void XcbWindow::OnConfigure(i32 x, i32 y, u32 width, u32 height, bool bRootCoordinates) {
+            if (width != mCache.size.width || height != mCache.size.height) {
+                mCache.size = Size(width, height);
+                mInput->Submit(InputEventRecord::WindowResize(width, height));
+                mCache.framebufferSize = mCache.size;
+                mInput->Submit(InputEventRecord::WindowFramebufferResize(width, height));
+            }
+            if (bRootCoordinates) {
+                SubmitPosition(x, y);
+            } else if (!mPending.bPosition) {
+                // relative to the frame, ask where the window is on the root once for the whole batch
+                mPending.position = xcb_translate_coordinates(mManager->mConnection, mWindow, mManager->mRoot, 0, 0).sequence;
+                mPending.bPosition = true;
+            }
+        }
+
+        void XcbWindow::OnFocus(bool bFocused) {
+            if (bFocused == mCache.bFocused) {
+                return;
+            }
+            mCache.bFocused = bFocused;
+            if (bFocused) {
+                mManager->mFocused = this;
+            } else if (mManager->mFocused == this) {
+                mManager->mFocused = nullptr;
+            }
+            if (mCache.cursorMode == CursorMode::Locked) {
+                // the grab follows the focus, same as GLFW's disabled cursor
+                ApplyCursorMode();
+            }
+            mInput->Submit(InputEventRecord::WindowFocus(bFocused));
+        }
+
+        void XcbWindow::OnCursorMotion(f64 x, f64 y, u32 time) {
+            if (bGrabbed) {
+                if (mCache.bRawMouseMotion && mManager->bHasXInput) {
+                    // XI_RawMotion drives the cursor
+                    return;
+                }
+                const f64 deltaX = x - mLastCursorX;
+                const f64 deltaY = y - mLastCursorY;
+                mLastCursorX = x;
+                mLastCursorY = y;
+                if (deltaX == 0.0 && deltaY == 0.0) {
+                    // the motion of our own warp back to the centre
+                    return;
+                }
+                mVirtualCursorX += deltaX;
+                mVirtualCursorY += deltaY;
+                SubmitCursorPosition(mVirtualCursorX, mVirtualCursorY, time);
+                return;
+            }
+            mLastCursorX = x;
+            mLastCursorY = y;
+            SubmitCursorPosition(x, y, time);
+        }
+
+        void XcbWindow::OnRawMotion(f64 deltaX, f64 deltaY, u32 time) {
+            if (!bGrabbed || !mCache.bRawMouseMotion) {
+                return;
+            }
+            mVirtualCursorX += deltaX;
+            mVirtualCursorY += deltaY;
+            SubmitCursorPosition(mVirtualCursorX, mVirtualCursorY, time);
+        }
+
+        void XcbWindow::OnContentScale(FSize scale) {
+            if (scale.width == mCache.contentScale.width && scale.height == mCache.contentScale.height) {
+                return;
+            }
+            mCache.contentScale = scale;
+            mInput->Submit(InputEventRecord::WindowContentScale(static_cast<f64>(scale.width), static_cast<f64>(scale.height)));
+        }
+
+        void XcbWindow::OnStateChanged(u32 atom) {
+            xcb_connection_t* connection = mManager->mConnection;
+            const XcbWindowManager::Atoms& atoms = mManager->mAtoms;
+            if (atom == atoms.netWmState && !mPending.bNetWmState) {
+                mPending.netWmState = xcb_get_property(connection, 0, mWindow, atoms.netWmState, XCB_ATOM_ATOM, 0, 64).sequence;
+                mPending.bNetWmState = true;
+            } else if (atom == atoms.wmState && !mPending.bWmState) {
+                mPending.wmState = xcb_get_property(connection, 0, mWindow, atoms.wmState, atoms.wmState, 0, 2).sequence;
+                mPending.bWmState = true;
+            }
+        }
+
+        void XcbWindow::ResolvePendingReplies() {
+            xcb_connection_t* connection = mManager->mConnection;
+            if (mPending.bPosition) {
+                mPending.bPosition = false;
+                if (xcb_translate_coordinates_reply_t* reply = xcb_translate_coordinates_reply(connection, { mPending.position }, nullptr)) {
+                    SubmitPosition(reply->dst_x, reply->dst_y);
+                    free(reply);
+                }
+            }
+            if (mPending.bNetWmState) {
+                mPending.bNetWmState = false;
+                xcb_get_property_reply_t* reply = xcb_get_property_reply(connection, { mPending.netWmState }, nullptr);
+                const bool bMaximized = HasNetWmState(reply, mManager->mAtoms.netWmStateMaximizedVert, mManager->mAtoms.netWmStateMaximizedHorz);
+                mCache.bHidden = HasNetWmState(reply, mManager->mAtoms.netWmStateHidden);
+                free(reply);
+                if (bMaximized != mCache.bMaximized) {
+                    mCache.bMaximized = bMaximized;
+                    mInput->Submit(InputEventRecord::WindowMaximize(bMaximized));
+                }
+            }
+            if (mPending.bWmState) {
+                mPending.bWmState = false;
+                xcb_get_property_reply_t* reply = xcb_get_property_reply(connection, { mPending.wmState }, nullptr);
+                const bool bIconified = ReadIconified(reply);
+                free(reply);
+                if (bIconified != mCache.bIconified) {
+                    mCache.bIconified = bIconified;
+                    mInput->Submit(InputEventRecord::WindowIconify(bIconified));
+                }
+            }
+            UpdateVisibility();
+        }
+
+        void XcbWindow::OnVisibility(WindowVisibilityState occlusion) {
+            mCache.occlusion = occlusion;
+        }
+
+        void XcbWindow::UpdateVisibility() {
+            const WindowVisibilityState visibility = ComputeVisibility();
+            if (visibility == mCache.visibility) {
+                return;
+            }
+            mCache.visibility = visibility;
+            mInput->Submit(InputEventRecord::WindowVisibility(visibility));
+        }
+
+        WindowVisibilityState XcbWindow::ComputeVisibility() const {
+            if (mCache.bIconified) {
+                return WindowVisibilityState::Iconified;
+            }
+            if (!mCache.bVisible || mCache.bHidden) {
+                return WindowVisibilityState::FullyObscured;
+            }
+            return mCache.occlusion;
+        }
+
+        void XcbWindow::RecenterCursor() {
+            if (!bGrabbed || (mCache.bRawMouseMotion && mManager->bHasXInput)) {
+                return;
+            }
+            const f64 centerX = static_cast<f64>(mCache.size.width / 2);
+            const f64 centerY = static_cast<f64>(mCache.size.height / 2);
+            if (mLastCursorX == centerX && mLastCursorY == centerY) {
+                return;
+            }
+            xcb_warp_pointer(mManager->mConnection, XCB_NONE, mWindow, 0, 0, 0, 0, static_cast<i16>(centerX), static_cast<i16>(centerY));
+            mLastCursorX = centerX;
+            mLastCursorY = centerY;
+        }
+
+        void XcbWindow::ApplyCursorMode() {
+            if (mCache.cursorMode == CursorMode::Locked && mCache.bFocused) {
+                Grab();
+            } else {
+                Ungrab();
+            }
+            u32 cursor = mManager->mHiddenCursor;
+            if (mCache.cursorMode == CursorMode::Normal) {
+                cursor = mCursor ? static_cast<XcbCursor*>(mCursor)->GetXcbCursor() : XCB_NONE;
+            }
+            xcb_change_window_attributes(mManager->mConnection, mWindow, XCB_CW_CURSOR, &cursor);
+            mManager->UpdateRawMotionSelection();
+        }
+
+        void XcbWindow::Grab() {
+            if (bGrabbed) {
+                return;
+            }
+            xcb_connection_t* connection = mManager->mConnection;
+            // confined to the window, the reply only says whether another client holds a grab
+            const u16 mask = XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_BUTTON_RELEASE | XCB_EVENT_MASK_POINTER_MOTION;
+            xcb_discard_reply(connection, xcb_grab_pointer(connection, 1, mWindow, mask, XCB_GRAB_MODE_ASYNC, XCB_GRAB_MODE_ASYNC, mWindow,
+                                              mManager->mHiddenCursor, XCB_CURRENT_TIME)
+                                              .sequence);
+            bGrabbed = true;
+            mLastCursorX = -1.0;
+            RecenterCursor();
+        }
+
+        void XcbWindow::Ungrab() {
+            if (!bGrabbed) {
+                return;
+            }
+            xcb_ungrab_pointer(mManager->mConnection, XCB_CURRENT_TIME);
+            bGrabbed = false;
+        }
+
+        void XcbWindow::SubmitPosition(i32 x, i32 y) {
+            if (x == static_cast<i32>(mCache.position.x) && y == static_cast<i32>(mCache.position.y)) {
+                return;
+            }
+            mCache.position = Point(x, y);
+            mInput->Submit(InputEventRecord::WindowPosition(static_cast<f64>(x), static_cast<f64>(y)));
+        }
+
+        void XcbWindow::SubmitCursorPosition(f64 x, f64 y, u32 time) {
+            mCache.cursorPosition = ToCursorPoint(x, y);
+            const InputSnapshot& state = mInput->mState;
+            // the first motion has nothing to be relative to, it would report the absolute position as the delta
+            const f64 deltaX = mInput->bCursorTracked ? x - state.cursorX : 0.0;
+            const f64 deltaY = mInput->bCursorTracked ? y - state.cursorY : 0.0;
+            mInput->bCursorTracked = true;
+            mInput->Submit(InputEventRecord::CursorPosition(x, y, deltaX, deltaY), time);
+        }
+
+        void XcbWindow::ChangeNetWmState(u32 action, u32 first, u32 second) {
+            // source 1, a request from a normal application
+            mManager->SendRootMessage(mWindow, mManager->mAtoms.netWmState, action, first, second, 1);
+        }
+
+        void XcbWindow::UpdateSizeHints(Size size) {
+            u32 hints[18] = {};
+            if (!bResizable) {
+                hints[0] = kMinSizeHint | kMaxSizeHint;
+                hints[5] = size.width;
+                hints[6] = size.height;
+                hints[7] = size.width;
+                hints[8] = size.height;
+            }
+            xcb_change_property(mManager->mConnection, XCB_PROP_MODE_REPLACE, mWindow, XCB_ATOM_WM_NORMAL_HINTS, XCB_ATOM_WM_SIZE_HINTS,
+                32, 18, hints);
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
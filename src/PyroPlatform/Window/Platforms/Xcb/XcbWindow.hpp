@@ -0,0 +1,193 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class XcbWindowManager;
+        class XcbWindowInput;
+        class XcbPresenter;
+        // Top level X window. Requests are only queued, XcbWindowManager flushes them on the next poll.
+        // State the window manager controls (size, position, focus, maximise, iconify) is cached from
+        // the events it sends back, so a setter is only reflected by the getters once that arrived.
+        class XcbWindow : public IWindow, DeleteCopy, DeleteMove {
+        public:
+            XcbWindow(XcbWindowManager* manager, const WindowInfo& info);
+            ~XcbWindow();
+
+            Size GetSize() const override;
+            Point GetPosition() const override;
+            Point GetCursorPosition() const override;
+            f32 GetOpacity() const override;
+            void SetSize(Size size) override;
+            void SetPosition(Point point) override;
+            void SetCursorPosition(Point point) override;
+            void SetCursorVisible(bool bVisible) override;
+            void SetCursorLockedToWindow(bool bLocked) override;
+            void SetOpacity(f32 opacity) override;
+            void SetCursor(ICursor* cursor) override;
+            void SetFullscreen(IMonitor* monitor) override;
+            void SetWindowState(WindowState state) override;
+            WindowState GetWindowState() const override;
+            eastl::string GetTitle() const override;
+            void SetTitle(eastl::string_view title) override;
+            Size GetFramebufferSize() const override;
+            f32 GetDPIScale() const override;
+            FSize GetContentScale() const override;
+            CursorMode GetCursorMode() const override;
+            bool IsStickyKeysEnabled() const override;
+            bool IsStickyMouseButtonsEnabled() const override;
+            bool IsRawMouseMotionEnabled() const override;
+            void SetCursorMode(CursorMode mode) override;
+            void SetStickyKeysEnabled(bool bEnabled) override;
+            void SetStickyMouseButtonsEnabled(bool bEnabled) override;
+            void SetRawMouseMotionEnabled(bool bEnabled) override;
+            void Show() override;
+            void Hide() override;
+            void Close() override;
+            void CancelClose() override;
+            void Focus() override;
+            void SetPassthrough(bool bPassthrough) override;
+            void SetTopMost(bool bTopMost) override;
+            void RequestAttention() override;
+            bool IsVisible() const override;
+            bool ShouldClose() const override;
+            bool IsFocused() const override;
+            bool IsHovered() const override;
+            WindowVisibilityState GetVisibilityState() const override;
+
+            // Waits for the server, the queries are sent together so it is a single round trip
+            void Refresh() override;
+
+            IWindowInput* GetInputHandler() override;
+
+            // MIT-SHM when the server is local, PutImage otherwise
+            bool PresentPixels(eastl::span<const u8> pixels, Size size, u32 stride, eastl::span<const WindowRect> dirtyRects = {}) override;
+
+            NativeHandle GetNativeWindow() const override;
+            NativeHandle GetNativeInstance() const override;
+
+            u32 GetXcbWindow() const {
+                return mWindow;
+            }
+            XcbWindowInput* GetXcbInput() const {
+                return mInput;
+            }
+            IMonitor* GetFullscreenMonitor() const {
+                return mCache.fullscreen;
+            }
+
+        private:
+            friend class XcbWindowManager;
+            friend class XcbWindowInput;
+
+            // Handlers for what the manager decodes, the cache is updated before submitting
+            void OnConfigure(i32 x, i32 y, u32 width, u32 height, bool bRootCoordinates);
+            void OnFocus(bool bFocused);
+            void OnCursorMotion(f64 x, f64 y, u32 time);
+            void OnRawMotion(f64 deltaX, f64 deltaY, u32 time);
+            void OnContentScale(FSize scale);
+            // PropertyNotify for _NET_WM_STATE or WM_STATE, the new value is fetched at the end of the batch
+            void OnStateChanged(u32 atom);
+            // VisibilityNotify, only the occlusion by other windows
+            void OnVisibility(WindowVisibilityState occlusion);
+            // Collects the replies requested while handling the batch
+            void ResolvePendingReplies();
+            // Parks the pointer of a locked cursor back in the middle of the window
+            void RecenterCursor();
+
+            void ApplyCursorMode();
+            void Grab();
+            void Ungrab();
+            void SubmitPosition(i32 x, i32 y);
+            void SubmitCursorPosition(f64 x, f64 y, u32 time);
+            // _NET_WM_STATE change through the window manager, action 0 removes, 1 adds
+            void ChangeNetWmState(u32 action, u32 first, u32 second = 0);
+            // WM_NORMAL_HINTS, a window that can't be resized has its minimum and maximum pinned
+            void UpdateSizeHints(Size size);
+            // Recomputed once per batch, so iconifying does not briefly report FullyObscured from the unmap
+            void UpdateVisibility();
+            WindowVisibilityState ComputeVisibility() const;
+
+            struct PropertyCache {
+                Size size = {};
+                Size framebufferSize = {};
+                Point position = {};
+                Point cursorPosition = {};
+                FSize contentScale = { 1.0f, 1.0f };
+                IMonitor* fullscreen = nullptr;
+                eastl::string title = {};
+                f32 opacity = 1.0f;
+                CursorMode cursorMode = CursorMode::Normal;
+                bool bStickyKeys = false;
+                bool bStickyMouseButtons = false;
+                bool bRawMouseMotion = false;
+                bool bVisible = false;
+                bool bShouldClose = false;
+                bool bFocused = false;
+                bool bHovered = false;
+                bool bIconified = false;
+                bool bMaximized = false;
+                // _NET_WM_STATE_HIDDEN, also set on windows of other virtual desktops by some window managers
+                bool bHidden = false;
+                bool bPassthrough = false;
+                bool bTopMost = false;
+                // last VisibilityNotify, compositing window managers always report the window unobscured
+                WindowVisibilityState occlusion = WindowVisibilityState::Visible;
+                WindowVisibilityState visibility = WindowVisibilityState::FullyObscured;
+            };
+            // sequence numbers of requests whose replies ResolvePendingReplies() waits for
+            struct PendingReplies {
+                u32 position = 0;
+                u32 netWmState = 0;
+                u32 wmState = 0;
+                bool bPosition = false;
+                bool bNetWmState = false;
+                bool bWmState = false;
+            };
+
+            PropertyCache mCache = {};
+            PendingReplies mPending = {};
+            XcbWindowManager* mManager = nullptr;
+            XcbWindowInput* mInput = nullptr;
+            // created by the first PresentPixels()
+            XcbPresenter* mPresenter = nullptr;
+            ICursor* mCursor = nullptr;
+            u32 mWindow = 0;
+            // reparenting window managers put the window in a frame, ConfigureNotify is then frame relative
+            u32 mParent = 0;
+            // a locked cursor reports a virtual position that moves by the deltas, while the
+            // pointer itself is parked in the middle of the window
+            f64 mVirtualCursorX = 0.0;
+            f64 mVirtualCursorY = 0.0;
+            f64 mLastCursorX = 0.0;
+            f64 mLastCursorY = 0.0;
+            Point mRestoreCursor = {};
+            bool bResizable = true;
+            bool bGrabbed = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,107 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbWindowInput.hpp"
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        XcbWindowInput::XcbWindowInput(XcbWindow* window, XcbWindowManager* manager)
+            : mWindow(window), mManager(manager) {
+            mEvents = new WindowEvents;
+            mEvents->SetClock(manager->mClock);
+        }
+        XcbWindowInput::~XcbWindowInput() {
+            delete mEvents;
+        }
+        bool XcbWindowInput::IsKeyDown(KeyCode key) {
+            return mPublished.IsKeyDown(key);
+        }
+
+        bool XcbWindowInput::IsMouseDown(MouseButton button) {
+            return mPublished.IsMouseDown(button);
+        }
+        bool XcbWindowInput::WasPressed(KeyCode key) const {
+            return mPublished.WasPressed(key);
+        }
+        bool XcbWindowInput::WasReleased(KeyCode key) const {
+            return mPublished.WasReleased(key);
+        }
+        bool XcbWindowInput::WasPressed(MouseButton button) const {
+            return mPublished.WasPressed(button);
+        }
+        bool XcbWindowInput::WasReleased(MouseButton button) const {
+            return mPublished.WasReleased(button);
+        }
+        InputSnapshot XcbWindowInput::GetSnapshot() const {
+            return mShared.Load();
+        }
+        void XcbWindowInput::PublishSnapshot() {
+            mPublished = mState;
+            mShared.Store(mPublished);
+            mState.ClearFrame();
+        }
+        WindowEvents& XcbWindowInput::GetEvents() {
+            return *mEvents;
+        }
+        void XcbWindowInput::SetBufferedEvents(bool bEnabled) {
+            if (!bEnabled) {
+                // don't lose what was recorded while buffering was on
+                DrainEvents();
+            }
+            bBuffered = bEnabled;
+        }
+        bool XcbWindowInput::IsBufferedEvents() const {
+            return bBuffered;
+        }
+        void XcbWindowInput::DrainEvents() {
+            while (!mQueue.Empty()) {
+                // copy out first, handlers may cause new events to be queued
+                const InputEventRecord record = mQueue.Front();
+                mQueue.Pop();
+                mEvents->Dispatch(*mWindow, record);
+            }
+            mEvents->FlushText();
+        }
+        void XcbWindowInput::SetEventCoalescing(InputEventType type, bool bEnabled) {
+            mQueue.SetCoalescing(type, bEnabled);
+        }
+        u64 XcbWindowInput::GetCoalescedCount(InputEventType type) const {
+            return mQueue.GetMergedCount(type);
+        }
+
+        void XcbWindowInput::Submit(InputEventRecord record, u32 serverTime) {
+            record.timestamp = mManager->StampEvent(serverTime);
+            record.sequence = mManager->mEventSequence++;
+            mState.Apply(record);
+            mManager->mEventStream.Push(*mWindow, record);
+            if (bBuffered) {
+                mQueue.Push(record);
+            } else {
+                mEvents->Dispatch(*mWindow, record);
+            }
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
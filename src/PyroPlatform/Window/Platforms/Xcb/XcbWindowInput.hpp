@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Forward.hpp>
+#include <PyroPlatform/Window/IWindowInput.hpp>
+#include <PyroPlatform/Window/Input/InputEventQueue.hpp>
+#include <PyroPlatform/Window/Input/InputSnapshot.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class XcbWindowManager;
+        class XcbWindow;
+        class XcbWindowInput : public IWindowInput, DeleteCopy, DeleteMove {
+        public:
+            XcbWindowInput(XcbWindow* window, XcbWindowManager* manager);
+            ~XcbWindowInput();
+
+            bool IsKeyDown(KeyCode key) override;
+            bool IsMouseDown(MouseButton button) override;
+            bool WasPressed(KeyCode key) const override;
+            bool WasReleased(KeyCode key) const override;
+            bool WasPressed(MouseButton button) const override;
+            bool WasReleased(MouseButton button) const override;
+            InputSnapshot GetSnapshot() const override;
+            void PublishSnapshot() override;
+
+            WindowEvents& GetEvents() override;
+
+            void SetBufferedEvents(bool bBuffered) override;
+            bool IsBufferedEvents() const override;
+            void DrainEvents() override;
+            void SetEventCoalescing(InputEventType type, bool bEnabled) override;
+            u64 GetCoalescedCount(InputEventType type) const override;
+
+            InputEventQueue& GetEventQueue() {
+                return mQueue;
+            }
+            XcbWindow* GetWindow() const {
+                return mWindow;
+            }
+
+        private:
+            friend class XcbWindowManager;
+            friend class XcbWindow;
+
+            // Called by the manager for every event it decodes, the X event loop is the callback here.
+            // serverTime is the X time the event carries, 0 (CurrentTime) for events without one.
+            void Submit(InputEventRecord record, u32 serverTime = 0);
+
+            XcbWindow* mWindow = nullptr;
+            XcbWindowManager* mManager = nullptr;
+            WindowEvents* mEvents = nullptr;
+            InputEventQueue mQueue = {};
+            // live state follows events as they arrive, the published copy is what queries see
+            InputSnapshot mState = {};
+            InputSnapshot mPublished = {};
+            // the published copy again, for GetSnapshot() from other threads
+            InputSnapshotBuffer mShared;
+            bool bBuffered = false;
+            // whether mState holds a real cursor position to take motion deltas from,
+            // cleared again when the cursor enters since it moved while outside
+            bool bCursorTracked = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,1071 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "XcbWindowManager.hpp"
+#include <EASTL/algorithm.h>
+#include <PyroCommon/Logger.hpp>
+#include <PyroPlatform/Factory.hpp>
+#include <PyroPlatform/Window/MonitorEvent.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbCursor.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbPresenter.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowInput.hpp>
+#include <PyroPlatform/Window/WindowEvents.hpp>
+
+#include <X11/cursorfont.h>
+#include <cstdlib>
+#include <cstring>
+#include <poll.h>
+#include <xcb/randr.h>
+#include <xcb/shape.h>
+#include <xcb/shm.h>
+#include <xcb/xcb.h>
+#include <xcb/xinput.h>
+
+#include <libassert/assert.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        namespace {
+            // the top bit of response_type marks events sent by another client
+            constexpr u8 kSyntheticBit = 0x80;
+            // autorepeat sends the release and the next press within the same millisecond or two
+            constexpr u32 kRepeatWindowMs = 20;
+            // how long GetClipboardText() waits for the owner of the selection to answer
+            constexpr int kSelectionTimeoutMs = 1000;
+            constexpr f32 kDefaultDpi = 96.0f;
+
+            f64 FromFixed3232(const xcb_input_fp3232_t& value) {
+                return static_cast<f64>(value.integral) + static_cast<f64>(value.frac) / 4294967296.0;
+            }
+        } // namespace
+
+        bool XcbWindowManager::Init() {
+#ifdef PYRO_PLATFORM_TIME
+            if (mClock == nullptr) {
+                mClock = PlatformFactory::Get<IClock>();
+            }
+#endif
+            Logger::Trace(mSink, "Initialising XCB window manager");
+            int screenNumber = 0;
+            mConnection = xcb_connect(nullptr, &screenNumber);
+            if (xcb_connection_has_error(mConnection)) {
+                Logger::Error(mSink, "Failed to connect to the X server! Reason: DISPLAY is unset or the server is not running");
+                xcb_disconnect(mConnection);
+                mConnection = nullptr;
+                return false;
+            }
+            xcb_screen_iterator_t screens = xcb_setup_roots_iterator(xcb_get_setup(mConnection));
+            for (int i = 0; i < screenNumber && screens.rem > 0; ++i) {
+                xcb_screen_next(&screens);
+            }
+            mScreen = screens.data;
+            mRoot = mScreen->root;
+
+            // every query goes out before the first reply is read, a single round trip for all of them
+            xcb_prefetch_extension_data(mConnection, &xcb_input_id);
+            xcb_prefetch_extension_data(mConnection, &xcb_randr_id);
+            xcb_prefetch_extension_data(mConnection, &xcb_shape_id);
+            xcb_prefetch_extension_data(mConnection, &xcb_shm_id);
+            const struct {
+                u32* atom;
+                const char* name;
+            } atomNames[] = {
+                { &mAtoms.wmProtocols, "WM_PROTOCOLS" },
+                { &mAtoms.wmDeleteWindow, "WM_DELETE_WINDOW" },
+                { &mAtoms.wmState, "WM_STATE" },
+                { &mAtoms.wmChangeState, "WM_CHANGE_STATE" },
+                { &mAtoms.netSupported, "_NET_SUPPORTED" },
+                { &mAtoms.netWmName, "_NET_WM_NAME" },
+                { &mAtoms.netWmPing, "_NET_WM_PING" },
+                { &mAtoms.netWmState, "_NET_WM_STATE" },
+                { &mAtoms.netWmStateAbove, "_NET_WM_STATE_ABOVE" },
+                { &mAtoms.netWmStateFullscreen, "_NET_WM_STATE_FULLSCREEN" },
+                { &mAtoms.netWmStateMaximizedVert, "_NET_WM_STATE_MAXIMIZED_VERT" },
+                { &mAtoms.netWmStateMaximizedHorz, "_NET_WM_STATE_MAXIMIZED_HORZ" },
+                { &mAtoms.netWmStateDemandsAttention, "_NET_WM_STATE_DEMANDS_ATTENTION" },
+                { &mAtoms.netWmStateHidden, "_NET_WM_STATE_HIDDEN" },
+                { &mAtoms.netWmWindowOpacity, "_NET_WM_WINDOW_OPACITY" },
+                { &mAtoms.netActiveWindow, "_NET_ACTIVE_WINDOW" },
+                { &mAtoms.netWorkarea, "_NET_WORKAREA" },
+                { &mAtoms.motifWmHints, "_MOTIF_WM_HINTS" },
+                { &mAtoms.utf8String, "UTF8_STRING" },
+                { &mAtoms.clipboard, "CLIPBOARD" },
+                { &mAtoms.targets, "TARGETS" },
+                { &mAtoms.incr, "INCR" },
+                { &mAtoms.pyroSelection, "PYRO_SELECTION" },
+            };
+            constexpr usize kAtomCount = sizeof(atomNames) / sizeof(atomNames[0]);
+            xcb_intern_atom_cookie_t atomCookies[kAtomCount];
+            for (usize i = 0; i < kAtomCount; ++i) {
+                atomCookies[i] = xcb_intern_atom(mConnection, 0, static_cast<u16>(strlen(atomNames[i].name)), atomNames[i].name);
+            }
+            const xcb_query_extension_reply_t* xinput = xcb_get_extension_data(mConnection, &xcb_input_id);
+            const xcb_query_extension_reply_t* randr = xcb_get_extension_data(mConnection, &xcb_randr_id);
+            const xcb_query_extension_reply_t* shape = xcb_get_extension_data(mConnection, &xcb_shape_id);
+            const xcb_query_extension_reply_t* shm = xcb_get_extension_data(mConnection, &xcb_shm_id);
+            xcb_input_xi_query_version_cookie_t xinputCookie = {};
+            xcb_randr_query_version_cookie_t randrCookie = {};
+            if (xinput && xinput->present) {
+                xinputCookie = xcb_input_xi_query_version(mConnection, 2, 2);
+            }
+            if (randr && randr->present) {
+                randrCookie = xcb_randr_query_version(mConnection, 1, 3);
+            }
+            bHasShape = shape && shape->present;
+            bHasShm = shm && shm->present;
+            mShmEventBase = bHasShm ? shm->first_event : 0;
+            for (usize i = 0; i < kAtomCount; ++i) {
+                xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(mConnection, atomCookies[i], nullptr);
+                *atomNames[i].atom = reply ? reply->atom : static_cast<xcb_atom_t>(XCB_ATOM_NONE);
+                free(reply);
+            }
+            if (xinput && xinput->present) {
+                xcb_input_xi_query_version_reply_t* reply = xcb_input_xi_query_version_reply(mConnection, xinputCookie, nullptr);
+                bHasXInput = reply && reply->major_version >= 2;
+                mXInputOpcode = xinput->major_opcode;
+                free(reply);
+            }
+            if (randr && randr->present) {
+                xcb_randr_query_version_reply_t* reply = xcb_randr_query_version_reply(mConnection, randrCookie, nullptr);
+                bHasRandr = reply && (reply->major_version > 1 || reply->minor_version >= 3);
+                mRandrEventBase = randr->first_event;
+                free(reply);
+            }
+            if (bHasRandr) {
+                xcb_randr_select_input(mConnection, mRoot,
+                    XCB_RANDR_NOTIFY_MASK_SCREEN_CHANGE | XCB_RANDR_NOTIFY_MASK_CRTC_CHANGE | XCB_RANDR_NOTIFY_MASK_OUTPUT_CHANGE);
+            }
+            Logger::Trace(mSink, "XInput2 {}, RandR 1.3 {}, Shape {}, MIT-SHM {}", bHasXInput ? "available" : "missing",
+                bHasRandr ? "available" : "missing", bHasShape ? "available" : "missing", bHasShm ? "available" : "missing");
+
+            // the root reports Xft.dpi and work area changes
+            const u32 rootMask = XCB_EVENT_MASK_PROPERTY_CHANGE;
+            xcb_change_window_attributes(mConnection, mRoot, XCB_CW_EVENT_MASK, &rootMask);
+            mHelperWindow = xcb_generate_id(mConnection);
+            const u32 helperMask = XCB_EVENT_MASK_PROPERTY_CHANGE;
+            xcb_create_window(mConnection, XCB_COPY_FROM_PARENT, mHelperWindow, mRoot, 0, 0, 1, 1, 0, XCB_WINDOW_CLASS_INPUT_ONLY,
+                XCB_COPY_FROM_PARENT, XCB_CW_EVENT_MASK, &helperMask);
+
+            // a cursor with nothing in its mask, for hidden and locked cursors
+            const u32 pixmap = xcb_generate_id(mConnection);
+            const u32 gc = xcb_generate_id(mConnection);
+            const u32 background = 0;
+            const xcb_rectangle_t pixel = { 0, 0, 1, 1 };
+            xcb_create_pixmap(mConnection, 1, pixmap, mRoot, 1, 1);
+            xcb_create_gc(mConnection, gc, pixmap, XCB_GC_FOREGROUND, &background);
+            xcb_poly_fill_rectangle(mConnection, pixmap, gc, 1, &pixel);
+            mHiddenCursor = xcb_generate_id(mConnection);
+            xcb_create_cursor(mConnection, mHiddenCursor, pixmap, pixmap, 0, 0, 0, 0, 0, 0, 0, 0);
+            xcb_free_gc(mConnection, gc);
+            xcb_free_pixmap(mConnection, pixmap);
+
+            mKeyboard.Load(mConnection);
+            if (xcb_get_property_reply_t* supported = xcb_get_property_reply(mConnection,
+                    xcb_get_property(mConnection, 0, mRoot, mAtoms.netSupported, XCB_ATOM_ATOM, 0, 1024), nullptr)) {
+                const u32* atoms = static_cast<const u32*>(xcb_get_property_value(supported));
+                mWmSupported.assign(atoms, atoms + xcb_get_property_value_length(supported) / 4);
+                free(supported);
+            }
+            ReadContentScale();
+            UpdateMonitors(false);
+            mEventStream.GetEvents().SetClock(mClock);
+            ResetServerTime();
+            xcb_flush(mConnection);
+            bInitialised = true;
+            return true;
+        }
+
+        bool XcbWindowManager::Terminate() {
+            Logger::Trace(mSink, "Terminating XCB window manager");
+            // the windows go with the connection
+            for (XcbWindow* window : mWindows) {
+                mEventStream.Remove(window);
+                delete window;
+            }
+            mWindows.clear();
+            mFocused = nullptr;
+            mMonitors.clear();
+            mMonitorsStorage.clear();
+            for (xcb_generic_event_t* event : mDeferredEvents) {
+                free(event);
+            }
+            mDeferredEvents.clear();
+            if (mConnection) {
+                xcb_free_cursor(mConnection, mHiddenCursor);
+                if (mCursorFont != 0) {
+                    xcb_close_font(mConnection, mCursorFont);
+                }
+                xcb_destroy_window(mConnection, mHelperWindow);
+                xcb_disconnect(mConnection);
+            }
+            mConnection = nullptr;
+            mScreen = nullptr;
+            mCursorFont = 0;
+            mKeyRelease = {};
+            bOwnsClipboard = false;
+            bRawMotionSelected = false;
+            bHasShm = false;
+            bConnectionLost = false;
+            bInitialised = false;
+            return true;
+        }
+
+        void XcbWindowManager::PollEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            HandleDeferredEvents();
+            xcb_flush(mConnection);
+            ProcessEvents(xcb_poll_for_event(mConnection));
+            FinishPoll();
+            mGamepadInput.Poll();
+        }
+        void XcbWindowManager::WaitEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            xcb_flush(mConnection);
+            if (!mDeferredEvents.empty()) {
+                // already have something to report, don't block
+                HandleDeferredEvents();
+                ProcessEvents(xcb_poll_for_event(mConnection));
+            } else {
+                ProcessEvents(xcb_wait_for_event(mConnection));
+            }
+            FinishPoll();
+            mGamepadInput.Poll();
+        }
+        void XcbWindowManager::DrainEvents() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            // merge the per-window queues by arrival order, there are only ever a handful of windows
+            for (;;) {
+                XcbWindowInput* next = nullptr;
+                for (XcbWindow* window : mWindows) {
+                    XcbWindowInput* input = window->GetXcbInput();
+                    InputEventQueue& queue = input->GetEventQueue();
+                    if (queue.Empty()) {
+                        continue;
+                    }
+                    if (!next || queue.Front().sequence < next->GetEventQueue().Front().sequence) {
+                        next = input;
+                    }
+                }
+                if (!next) {
+                    break;
+                }
+                const InputEventRecord record = next->GetEventQueue().Front();
+                next->GetEventQueue().Pop();
+                next->GetEvents().Dispatch(*next->GetWindow(), record);
+            }
+            for (XcbWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().FlushText();
+            }
+        }
+        void XcbWindowManager::InjectClock(IClock* clock) {
+            mClock = clock;
+            ResetServerTime();
+            mEventStream.GetEvents().SetClock(clock);
+            for (XcbWindow* window : mWindows) {
+                window->GetInputHandler()->GetEvents().SetClock(clock);
+            }
+        }
+        WindowEvents& XcbWindowManager::GetEvents() {
+            return mEventStream.GetEvents();
+        }
+
+        void XcbWindowManager::ProcessEvents(xcb_generic_event_t* event) {
+            while (event) {
+                HandleEvent(event);
+                free(event);
+                event = xcb_poll_for_queued_event(mConnection);
+                if (!event && mKeyRelease.bPending) {
+                    // the press of an autorepeat pair can still be in the socket, one more read settles it
+                    event = xcb_poll_for_event(mConnection);
+                }
+            }
+            FinishBatch();
+        }
+        void XcbWindowManager::HandleDeferredEvents() {
+            if (mDeferredEvents.empty()) {
+                return;
+            }
+            eastl::vector<xcb_generic_event_t*> events = eastl::move(mDeferredEvents);
+            mDeferredEvents.clear();
+            for (xcb_generic_event_t* event : events) {
+                HandleEvent(event);
+                free(event);
+            }
+            FinishBatch();
+        }
+        void XcbWindowManager::FinishBatch() {
+            FlushKeyRelease();
+            for (XcbWindow* window : mWindows) {
+                window->ResolvePendingReplies();
+                window->RecenterCursor();
+            }
+            xcb_flush(mConnection);
+        }
+        void XcbWindowManager::FinishPoll() {
+            if (!bConnectionLost && xcb_connection_has_error(mConnection)) {
+                Logger::Error(mSink, "Lost the connection to the X server!");
+                bConnectionLost = true;
+                // nothing will arrive anymore, let the application wind down
+                for (XcbWindow* window : mWindows) {
+                    window->mCache.bShouldClose = true;
+                }
+            }
+            for (XcbWindow* window : mWindows) {
+                IWindowInput* input = window->GetInputHandler();
+                // text typed during this poll goes out as one run, buffered windows do this on drain
+                input->GetEvents().FlushText();
+                input->PublishSnapshot();
+            }
+            mEventStream.Dispatch();
+            if (bMonitorsDirty) {
+                RefreshMonitors();
+            }
+        }
+
+        void XcbWindowManager::HandleEvent(xcb_generic_event_t* event) {
+            const u8 type = event->response_type & ~kSyntheticBit;
+            if (mKeyRelease.bPending && type != XCB_KEY_PRESS) {
+                FlushKeyRelease();
+            }
+            switch (type) {
+            case 0: {
+                const auto* error = reinterpret_cast<const xcb_generic_error_t*>(event);
+                Logger::Error(mSink, "X request {}.{} failed with error {}", error->major_code, error->minor_code, error->error_code);
+                break;
+            }
+            case XCB_KEY_PRESS: {
+                const auto* key = reinterpret_cast<const xcb_key_press_event_t*>(event);
+                bool bRepeating = false;
+                if (mKeyRelease.bPending) {
+                    if (mKeyRelease.window == key->event && mKeyRelease.keycode == key->detail && key->time - mKeyRelease.time < kRepeatWindowMs) {
+                        // autorepeat, the key was never let go
+                        mKeyRelease.bPending = false;
+                        bRepeating = true;
+                    } else {
+                        FlushKeyRelease();
+                    }
+                }
+                if (XcbWindow* window = FindWindow(key->event)) {
+                    HandleKey(window, key->detail, key->state, true, bRepeating, key->time);
+                }
+                break;
+            }
+            case XCB_KEY_RELEASE: {
+                const auto* key = reinterpret_cast<const xcb_key_release_event_t*>(event);
+                mKeyRelease = { key->event, key->time, key->state, key->detail, true };
+                break;
+            }
+            case XCB_BUTTON_PRESS:
+            case XCB_BUTTON_RELEASE: {
+                const auto* button = reinterpret_cast<const xcb_button_press_event_t*>(event);
+                XcbWindow* window = FindWindow(button->event);
+                if (!window) {
+                    break;
+                }
+                const bool bDown = type == XCB_BUTTON_PRESS;
+                if (button->detail >= 4 && button->detail <= 7) {
+                    // wheel steps come as clicks of buttons 4 to 7, the press is the step
+                    if (bDown) {
+                        const f64 x = button->detail == 6 ? 1.0 : button->detail == 7 ? -1.0 : 0.0;
+                        const f64 y = button->detail == 4 ? 1.0 : button->detail == 5 ? -1.0 : 0.0;
+                        window->mInput->Submit(InputEventRecord::CursorScroll(x, y), button->time);
+                    }
+                    break;
+                }
+                i32 index = 0;
+                switch (button->detail) {
+                case 1:
+                    index = static_cast<i32>(MouseButton::Left);
+                    break;
+                case 2:
+                    index = static_cast<i32>(MouseButton::Middle);
+                    break;
+                case 3:
+                    index = static_cast<i32>(MouseButton::Right);
+                    break;
+                default:
+                    // the side buttons start at 8, after the wheel
+                    index = static_cast<i32>(button->detail) - 5;
+                    break;
+                }
+                if (index > static_cast<i32>(MouseButton::Last)) {
+                    break;
+                }
+                window->mInput->Submit(InputEventRecord::Mouse(static_cast<MouseButton>(index), XcbKeyboard::GetModifiers(button->state), bDown), button->time);
+                break;
+            }
+            case XCB_MOTION_NOTIFY: {
+                // without XInput2, and while the pointer is grabbed
+                const auto* motion = reinterpret_cast<const xcb_motion_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(motion->event)) {
+                    window->OnCursorMotion(static_cast<f64>(motion->event_x), static_cast<f64>(motion->event_y), motion->time);
+                }
+                break;
+            }
+            case XCB_ENTER_NOTIFY:
+            case XCB_LEAVE_NOTIFY: {
+                const auto* crossing = reinterpret_cast<const xcb_enter_notify_event_t*>(event);
+                XcbWindow* window = FindWindow(crossing->event);
+                // grabs move the pointer between windows without it crossing anything
+                if (!window || crossing->mode != XCB_NOTIFY_MODE_NORMAL) {
+                    break;
+                }
+                const bool bEntered = type == XCB_ENTER_NOTIFY;
+                if (bEntered != window->mCache.bHovered) {
+                    window->mCache.bHovered = bEntered;
+                    window->mInput->Submit(InputEventRecord::CursorEnter(bEntered), crossing->time);
+                }
+                if (bEntered) {
+                    window->mInput->bCursorTracked = false;
+                    window->OnCursorMotion(static_cast<f64>(crossing->event_x), static_cast<f64>(crossing->event_y), crossing->time);
+                }
+                break;
+            }
+            case XCB_FOCUS_IN:
+            case XCB_FOCUS_OUT: {
+                const auto* focus = reinterpret_cast<const xcb_focus_in_event_t*>(event);
+                // keyboard grabs (alt-tab, window manager menus) move the focus only for a moment
+                if (focus->mode == XCB_NOTIFY_MODE_GRAB || focus->mode == XCB_NOTIFY_MODE_UNGRAB) {
+                    break;
+                }
+                if (XcbWindow* window = FindWindow(focus->event)) {
+                    window->OnFocus(type == XCB_FOCUS_IN);
+                }
+                break;
+            }
+            case XCB_CONFIGURE_NOTIFY: {
+                const auto* configure = reinterpret_cast<const xcb_configure_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(configure->window)) {
+                    // window managers send synthetic ones in root coordinates, real ones are relative to the parent
+                    const bool bRootCoordinates = (configure->response_type & kSyntheticBit) != 0 || window->mParent == mRoot;
+                    window->OnConfigure(configure->x, configure->y, configure->width, configure->height, bRootCoordinates);
+                }
+                break;
+            }
+            case XCB_REPARENT_NOTIFY: {
+                const auto* reparent = reinterpret_cast<const xcb_reparent_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(reparent->window)) {
+                    window->mParent = reparent->parent;
+                }
+                break;
+            }
+            case XCB_EXPOSE: {
+                // count is how many more follow in the series, WindowEvents delivers them together
+                const auto* expose = reinterpret_cast<const xcb_expose_event_t*>(event);
+                if (XcbWindow* window = FindWindow(expose->window)) {
+                    window->mInput->Submit(InputEventRecord::WindowExpose(expose->x, expose->y, expose->width, expose->height, expose->count));
+                }
+                break;
+            }
+            case XCB_MAP_NOTIFY: {
+                const auto* map = reinterpret_cast<const xcb_map_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(map->window)) {
+                    window->mCache.bVisible = true;
+                }
+                break;
+            }
+            case XCB_UNMAP_NOTIFY: {
+                const auto* unmap = reinterpret_cast<const xcb_unmap_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(unmap->window)) {
+                    window->mCache.bVisible = false;
+                }
+                break;
+            }
+            case XCB_VISIBILITY_NOTIFY: {
+                const auto* visibility = reinterpret_cast<const xcb_visibility_notify_event_t*>(event);
+                if (XcbWindow* window = FindWindow(visibility->window)) {
+                    switch (visibility->state) {
+                    case XCB_VISIBILITY_UNOBSCURED:
+                        window->OnVisibility(WindowVisibilityState::Visible);
+                        break;
+                    case XCB_VISIBILITY_PARTIALLY_OBSCURED:
+                        window->OnVisibility(WindowVisibilityState::PartiallyObscured);
+                        break;
+                    case XCB_VISIBILITY_FULLY_OBSCURED:
+                        window->OnVisibility(WindowVisibilityState::FullyObscured);
+                        break;
+                    }
+                }
+                break;
+            }
+            case XCB_CLIENT_MESSAGE: {
+                const auto* message = reinterpret_cast<const xcb_client_message_event_t*>(event);
+                if (message->type != mAtoms.wmProtocols || message->format != 32) {
+                    break;
+                }
+                const u32 protocol = message->data.data32[0];
+                if (protocol == mAtoms.wmDeleteWindow) {
+                    if (XcbWindow* window = FindWindow(message->window)) {
+                        window->mCache.bShouldClose = true;
+                        window->mInput->Submit(InputEventRecord::WindowClose());
+                    }
+                } else if (protocol == mAtoms.netWmPing) {
+                    // answered right away, otherwise the window manager offers to kill the application
+                    xcb_client_message_event_t pong = *message;
+                    pong.window = mRoot;
+                    xcb_send_event(mConnection, 0, mRoot, XCB_EVENT_MASK_SUBSTRUCTURE_NOTIFY | XCB_EVENT_MASK_SUBSTRUCTURE_REDIRECT,
+                        reinterpret_cast<const char*>(&pong));
+                }
+                break;
+            }
+            case XCB_PROPERTY_NOTIFY: {
+                const auto* property = reinterpret_cast<const xcb_property_notify_event_t*>(event);
+                if (property->window == mRoot) {
+                    if (property->atom == XCB_ATOM_RESOURCE_MANAGER) {
+                        ReadContentScale();
+                    } else if (property->atom == mAtoms.netWorkarea) {
+                        bMonitorsDirty = true;
+                    }
+                } else if (XcbWindow* window = FindWindow(property->window)) {
+                    window->OnStateChanged(property->atom);
+                }
+                break;
+            }
+            case XCB_SELECTION_REQUEST:
+                HandleSelectionRequest(event);
+                break;
+            case XCB_SELECTION_CLEAR: {
+                const auto* clear = reinterpret_cast<const xcb_selection_clear_event_t*>(event);
+                if (clear->selection == mAtoms.clipboard) {
+                    bOwnsClipboard = false;
+                }
+                break;
+            }
+            case XCB_MAPPING_NOTIFY: {
+                const auto* mapping = reinterpret_cast<const xcb_mapping_notify_event_t*>(event);
+                if (mapping->request == XCB_MAPPING_KEYBOARD) {
+                    mKeyboard.Load(mConnection);
+                }
+                break;
+            }
+            case XCB_GE_GENERIC: {
+                const auto* generic = reinterpret_cast<const xcb_ge_generic_event_t*>(event);
+                if (!bHasXInput || generic->extension != mXInputOpcode) {
+                    break;
+                }
+                if (generic->event_type == XCB_INPUT_MOTION) {
+                    const auto* motion = reinterpret_cast<const xcb_input_motion_event_t*>(event);
+                    if (XcbWindow* window = FindWindow(motion->event)) {
+                        // 16.16 fixed point, sub-pixel where the device has it
+                        window->OnCursorMotion(static_cast<f64>(motion->event_x) / 65536.0, static_cast<f64>(motion->event_y) / 65536.0, motion->time);
+                    }
+                } else if (generic->event_type == XCB_INPUT_RAW_MOTION && mFocused) {
+                    const auto* raw = reinterpret_cast<const xcb_input_raw_motion_event_t*>(event);
+                    const u32* mask = xcb_input_raw_button_press_valuator_mask(raw);
+                    const u32 axisCount = static_cast<u32>(xcb_input_raw_button_press_valuator_mask_length(raw)) * 32;
+                    const xcb_input_fp3232_t* values = xcb_input_raw_button_press_axisvalues_raw(raw);
+                    // the values are packed, one for every bit set in the mask
+                    f64 delta[2] = {};
+                    u32 value = 0;
+                    for (u32 axis = 0; axis < 2 && axis < axisCount; ++axis) {
+                        if (mask[axis / 32] & (1u << (axis % 32))) {
+                            delta[axis] = FromFixed3232(values[value++]);
+                        }
+                    }
+                    mFocused->OnRawMotion(delta[0], delta[1], raw->time);
+                }
+                break;
+            }
+            default:
+                if (bHasRandr && (type == mRandrEventBase + XCB_RANDR_SCREEN_CHANGE_NOTIFY || type == mRandrEventBase + XCB_RANDR_NOTIFY)) {
+                    bMonitorsDirty = true;
+                } else if (bHasShm && type == mShmEventBase + XCB_SHM_COMPLETION) {
+                    const auto* completion = reinterpret_cast<const xcb_shm_completion_event_t*>(event);
+                    XcbWindow* window = FindWindow(completion->drawable);
+                    if (window && window->mPresenter) {
+                        window->mPresenter->OnCompletion(completion->shmseg, completion->sequence);
+                    }
+                }
+                break;
+            }
+        }
+
+        void XcbWindowManager::HandleKey(XcbWindow* window, u8 keycode, u16 state, bool bDown, bool bRepeating, u32 time) {
+            window->mInput->Submit(InputEventRecord::Key(XcbKeyboard::GetPhysicalKey(keycode), keycode, XcbKeyboard::GetModifiers(state), bDown, bRepeating), time);
+            if (!bDown || (state & XCB_MOD_MASK_CONTROL)) {
+                return;
+            }
+            // control characters are left to the key events, the same filter GLFW applies
+            const u32 codePoint = mKeyboard.GetCodePoint(keycode, state);
+            if (codePoint < 32 || (codePoint > 126 && codePoint < 160)) {
+                return;
+            }
+            window->mInput->Submit(InputEventRecord::CharInput(codePoint), time);
+        }
+
+        u64 XcbWindowManager::StampEvent(u32 serverTime) {
+            if (!mClock) {
+                return 0;
+            }
+            const u64 now = mClock->GetTicks();
+            u64 timestamp = serverTime != XCB_CURRENT_TIME ? mServerTime.Map(serverTime, now) : now;
+            timestamp = eastl::max(timestamp, mLastTimestamp);
+            mLastTimestamp = timestamp;
+            return timestamp;
+        }
+        void XcbWindowManager::ResetServerTime() {
+            mServerTime = ServerTimeMapper(mClock ? mClock->GetTickFrequency() : 1000);
+            mLastTimestamp = 0;
+        }
+
+        void XcbWindowManager::FlushKeyRelease() {
+            if (!mKeyRelease.bPending) {
+                return;
+            }
+            mKeyRelease.bPending = false;
+            if (XcbWindow* window = FindWindow(mKeyRelease.window)) {
+                HandleKey(window, mKeyRelease.keycode, mKeyRelease.state, false, false, mKeyRelease.time);
+            }
+        }
+
+        void XcbWindowManager::HandleSelectionRequest(xcb_generic_event_t* event) {
+            const auto* request = reinterpret_cast<const xcb_selection_request_event_t*>(event);
+            // send_event always copies 32 bytes, more than a SelectionNotify has
+            union {
+                xcb_selection_notify_event_t event;
+                char bytes[32];
+            } notify = {};
+            notify.event.response_type = XCB_SELECTION_NOTIFY;
+            notify.event.time = request->time;
+            notify.event.requestor = request->requestor;
+            notify.event.selection = request->selection;
+            notify.event.target = request->target;
+            notify.event.property = XCB_NONE;
+            // obsolete clients leave the property out and mean the target
+            const u32 property = request->property != XCB_NONE ? request->property : request->target;
+            if (bOwnsClipboard && request->selection == mAtoms.clipboard) {
+                if (request->target == mAtoms.targets) {
+                    const u32 targets[] = { mAtoms.targets, mAtoms.utf8String, XCB_ATOM_STRING };
+                    xcb_change_property(mConnection, XCB_PROP_MODE_REPLACE, request->requestor, property, XCB_ATOM_ATOM, 32, 3, targets);
+                    notify.event.property = property;
+                } else if (request->target == mAtoms.utf8String || request->target == XCB_ATOM_STRING) {
+                    xcb_change_property(mConnection, XCB_PROP_MODE_REPLACE, request->requestor, property, request->target, 8,
+                        static_cast<u32>(mClipboard.size()), mClipboard.data());
+                    notify.event.property = property;
+                }
+            }
+            xcb_send_event(mConnection, 0, request->requestor, XCB_EVENT_MASK_NO_EVENT, notify.bytes);
+        }
+
+        bool XcbWindowManager::HasClipboardText() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            if (bOwnsClipboard) {
+                return true;
+            }
+            xcb_get_selection_owner_reply_t* reply =
+                xcb_get_selection_owner_reply(mConnection, xcb_get_selection_owner(mConnection, mAtoms.clipboard), nullptr);
+            const bool bHasOwner = reply && reply->owner != XCB_NONE;
+            free(reply);
+            return bHasOwner;
+        }
+
+        eastl::string XcbWindowManager::GetClipboardText() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            if (bOwnsClipboard) {
+                return mClipboard;
+            }
+            xcb_convert_selection(mConnection, mHelperWindow, mAtoms.clipboard, mAtoms.utf8String, mAtoms.pyroSelection, XCB_CURRENT_TIME);
+            xcb_flush(mConnection);
+
+            bool bReceived = false;
+            bool bConverted = false;
+            while (!bReceived) {
+                while (xcb_generic_event_t* event = xcb_poll_for_event(mConnection)) {
+                    const auto* notify = reinterpret_cast<const xcb_selection_notify_event_t*>(event);
+                    if ((event->response_type & ~kSyntheticBit) == XCB_SELECTION_NOTIFY && notify->requestor == mHelperWindow) {
+                        bConverted = notify->property != XCB_NONE;
+                        bReceived = true;
+                        free(event);
+                        break;
+                    }
+                    // everything else is handled on the next poll, in order
+                    mDeferredEvents.push_back(event);
+                }
+                if (bReceived || xcb_connection_has_error(mConnection)) {
+                    break;
+                }
+                pollfd fd = { xcb_get_file_descriptor(mConnection), POLLIN, 0 };
+                if (poll(&fd, 1, kSelectionTimeoutMs) <= 0) {
+                    Logger::Error(mSink, "Failed to read the clipboard! Reason: the owner did not answer");
+                    break;
+                }
+            }
+            if (!bConverted) {
+                return {};
+            }
+            eastl::string text = {};
+            xcb_get_property_reply_t* reply = xcb_get_property_reply(mConnection,
+                xcb_get_property(mConnection, 1, mHelperWindow, mAtoms.pyroSelection, XCB_GET_PROPERTY_TYPE_ANY, 0, UINT32_MAX / 4), nullptr);
+            if (reply) {
+                if (reply->type == mAtoms.incr) {
+                    Logger::Error(mSink, "Failed to read the clipboard! Reason: incremental transfers are not supported");
+                } else {
+                    text.assign(static_cast<const char*>(xcb_get_property_value(reply)), static_cast<usize>(xcb_get_property_value_length(reply)));
+                }
+                free(reply);
+            }
+            return text;
+        }
+
+        void XcbWindowManager::SetClipboardText(eastl::string_view text) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            mClipboard.assign(text.data(), text.size());
+            xcb_set_selection_owner(mConnection, mHelperWindow, mAtoms.clipboard, XCB_CURRENT_TIME);
+            xcb_flush(mConnection);
+            bOwnsClipboard = true;
+        }
+
+        eastl::span<IMonitor*> XcbWindowManager::GetMonitors() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            return eastl::span<IMonitor*>(mMonitors.data(), mMonitors.size());
+        }
+
+        IMonitor* XcbWindowManager::GetPrimaryMonitor() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            if (mMonitors.empty()) {
+                Logger::Error(mSink, "No monitor was found! Reason: no RandR output is active");
+                return nullptr;
+            }
+            // UpdateMonitors() keeps the primary output first
+            return mMonitors.front();
+        }
+        IMonitor* XcbWindowManager::GetMonitorForWindow(IWindow* window) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            ASSERT(dynamic_cast<XcbWindow*>(window) != nullptr, "Type must be of XcbWindow!");
+            if (IMonitor* fullscreen = static_cast<XcbWindow*>(window)->GetFullscreenMonitor()) {
+                return fullscreen;
+            }
+            const Point position = window->GetPosition();
+            const Size size = window->GetSize();
+            const i64 left = static_cast<i32>(position.x);
+            const i64 top = static_cast<i32>(position.y);
+            const i64 right = left + size.width;
+            const i64 bottom = top + size.height;
+
+            IMonitor* best = nullptr;
+            i64 bestArea = 0;
+            for (IMonitor* monitor : mMonitors) {
+                const Point monitorPosition = monitor->GetPosition();
+                const Size resolution = monitor->GetResolution();
+                const i64 monitorLeft = static_cast<i32>(monitorPosition.x);
+                const i64 monitorTop = static_cast<i32>(monitorPosition.y);
+                const i64 width = eastl::min(right, monitorLeft + resolution.width) - eastl::max(left, monitorLeft);
+                const i64 height = eastl::min(bottom, monitorTop + resolution.height) - eastl::max(top, monitorTop);
+                if (width > 0 && height > 0 && width * height > bestArea) {
+                    best = monitor;
+                    bestArea = width * height;
+                }
+            }
+            return best;
+        }
+        void XcbWindowManager::RefreshMonitors() {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            UpdateMonitors(true);
+        }
+        void XcbWindowManager::UpdateMonitors(bool bEmitEvents) {
+            bMonitorsDirty = false;
+            ReadWorkArea();
+            xcb_randr_get_screen_resources_current_reply_t* resources = nullptr;
+            eastl::vector<u32> outputs = {};
+            if (bHasRandr) {
+                const xcb_randr_get_output_primary_cookie_t primaryCookie = xcb_randr_get_output_primary(mConnection, mRoot);
+                resources = xcb_randr_get_screen_resources_current_reply(mConnection, xcb_randr_get_screen_resources_current(mConnection, mRoot), nullptr);
+                if (xcb_randr_get_output_primary_reply_t* primary = xcb_randr_get_output_primary_reply(mConnection, primaryCookie, nullptr)) {
+                    mPrimaryOutput = primary->output;
+                    free(primary);
+                }
+            }
+            if (resources) {
+                const xcb_randr_output_t* ids = xcb_randr_get_screen_resources_current_outputs(resources);
+                const int count = xcb_randr_get_screen_resources_current_outputs_length(resources);
+                eastl::vector<xcb_randr_get_output_info_cookie_t> cookies(static_cast<usize>(count));
+                for (int i = 0; i < count; ++i) {
+                    cookies[i] = xcb_randr_get_output_info(mConnection, ids[i], resources->config_timestamp);
+                }
+                for (int i = 0; i < count; ++i) {
+                    xcb_randr_get_output_info_reply_t* info = xcb_randr_get_output_info_reply(mConnection, cookies[i], nullptr);
+                    // only outputs that show something, a connected output without a CRTC is switched off
+                    if (info && info->connection == XCB_RANDR_CONNECTION_CONNECTED && info->crtc != XCB_NONE) {
+                        outputs.push_back(ids[i]);
+                    }
+                    free(info);
+                }
+            }
+            if (outputs.empty()) {
+                // the screen stands in for the monitors RandR can't tell about
+                outputs.push_back(0);
+            }
+            // the primary goes first, like GLFW
+            auto primary = eastl::find(outputs.begin(), outputs.end(), mPrimaryOutput);
+            if (primary != outputs.end()) {
+                eastl::rotate(outputs.begin(), primary, primary + 1);
+            }
+
+            eastl::vector<eastl::unique_ptr<XcbMonitor>> storage = {};
+            eastl::vector<IMonitor*> connected = {};
+            eastl::vector<IMonitor*> changed = {};
+            storage.reserve(outputs.size());
+            for (u32 output : outputs) {
+                auto it = eastl::find_if(mMonitorsStorage.begin(), mMonitorsStorage.end(),
+                    [output](const eastl::unique_ptr<XcbMonitor>& m) { return m->GetOutput() == output; });
+                if (it != mMonitorsStorage.end()) {
+                    storage.push_back(eastl::move(*it));
+                    mMonitorsStorage.erase(it);
+                    if (storage.back()->Refresh(resources)) {
+                        changed.push_back(storage.back().get());
+                    }
+                } else {
+                    storage.emplace_back(eastl::make_unique<XcbMonitor>(this, output));
+                    storage.back()->Refresh(resources);
+                    connected.push_back(storage.back().get());
+                }
+            }
+            free(resources);
+
+            // what is left over was unplugged, reported while it still exists
+            for (const eastl::unique_ptr<XcbMonitor>& monitor : mMonitorsStorage) {
+                Logger::Info(mSink, "Monitor \"{}\" disconnected", monitor->GetName());
+                for (XcbWindow* window : mWindows) {
+                    if (window->mCache.fullscreen == monitor.get()) {
+                        window->mCache.fullscreen = nullptr;
+                    }
+                }
+                if (bEmitEvents) {
+                    MonitorEvent event(*monitor, MonitorEventType::Disconnected);
+                    mEventStream.GetEvents().Emit(event);
+                }
+            }
+            mMonitorsStorage = eastl::move(storage);
+            mMonitors.clear();
+            for (const eastl::unique_ptr<XcbMonitor>& monitor : mMonitorsStorage) {
+                mMonitors.push_back(monitor.get());
+            }
+            if (!bEmitEvents) {
+                return;
+            }
+            for (IMonitor* monitor : connected) {
+                Logger::Info(mSink, "Monitor \"{}\" connected", monitor->GetName());
+                MonitorEvent event(*monitor, MonitorEventType::Connected);
+                mEventStream.GetEvents().Emit(event);
+            }
+            for (IMonitor* monitor : changed) {
+                MonitorEvent event(*monitor, MonitorEventType::Changed);
+                mEventStream.GetEvents().Emit(event);
+            }
+        }
+        void XcbWindowManager::ReadWorkArea() {
+            mWorkArea = {};
+            xcb_get_property_reply_t* reply = xcb_get_property_reply(mConnection,
+                xcb_get_property(mConnection, 0, mRoot, mAtoms.netWorkarea, XCB_ATOM_CARDINAL, 0, 4), nullptr);
+            if (!reply) {
+                return;
+            }
+            // one rectangle per desktop, the first one stands for all of them
+            if (reply->format == 32 && xcb_get_property_value_length(reply) >= 16) {
+                const u32* values = static_cast<const u32*>(xcb_get_property_value(reply));
+                mWorkArea = { static_cast<i32>(values[0]), static_cast<i32>(values[1]), static_cast<i32>(values[2]), static_cast<i32>(values[3]) };
+            }
+            free(reply);
+        }
+        void XcbWindowManager::ReadContentScale() {
+            // Xft.dpi in the resource database is what desktops set when scaling, same source as GLFW
+            f32 dpi = kDefaultDpi;
+            xcb_get_property_reply_t* reply = xcb_get_property_reply(mConnection,
+                xcb_get_property(mConnection, 0, mRoot, XCB_ATOM_RESOURCE_MANAGER, XCB_ATOM_STRING, 0, 16384), nullptr);
+            if (reply) {
+                eastl::string_view database(static_cast<const char*>(xcb_get_property_value(reply)), static_cast<usize>(xcb_get_property_value_length(reply)));
+                constexpr eastl::string_view kKey = "Xft.dpi:";
+                while (!database.empty()) {
+                    const usize end = database.find('\n');
+                    const eastl::string_view line = database.substr(0, end);
+                    if (line.starts_with(kKey)) {
+                        const eastl::string value(line.data() + kKey.size(), line.size() - kKey.size());
+                        const f32 parsed = strtof(value.c_str(), nullptr);
+                        if (parsed > 0.0f) {
+                            dpi = parsed;
+                        }
+                        break;
+                    }
+                    database.remove_prefix(end == eastl::string_view::npos ? database.size() : end + 1);
+                }
+                free(reply);
+            }
+            const FSize scale = FSize(dpi / kDefaultDpi, dpi / kDefaultDpi);
+            if (scale.width == mContentScale.width && scale.height == mContentScale.height) {
+                return;
+            }
+            mContentScale = scale;
+            for (XcbWindow* window : mWindows) {
+                window->OnContentScale(scale);
+            }
+            bMonitorsDirty = true;
+        }
+
+        void XcbWindowManager::UpdateRawMotionSelection() {
+            if (!bHasXInput) {
+                return;
+            }
+            const bool bWanted = eastl::any_of(mWindows.begin(), mWindows.end(),
+                [](const XcbWindow* window) { return window->bGrabbed && window->mCache.bRawMouseMotion; });
+            if (bWanted == bRawMotionSelected) {
+                return;
+            }
+            // raw events are only delivered to the root, and cost a wakeup per device report
+            struct {
+                xcb_input_event_mask_t header;
+                u32 mask;
+            } mask = { { XCB_INPUT_DEVICE_ALL_MASTER, 1 }, bWanted ? static_cast<u32>(XCB_INPUT_XI_EVENT_MASK_RAW_MOTION) : 0u };
+            xcb_input_xi_select_events(mConnection, mRoot, 1, &mask.header);
+            bRawMotionSelected = bWanted;
+        }
+
+        XcbWindow* XcbWindowManager::FindWindow(u32 window) const {
+            for (XcbWindow* candidate : mWindows) {
+                if (candidate->GetXcbWindow() == window) {
+                    return candidate;
+                }
+            }
+            return nullptr;
+        }
+
+        bool XcbWindowManager::IsWmSupported(u32 atom) const {
+            return eastl::find(mWmSupported.begin(), mWmSupported.end(), atom) != mWmSupported.end();
+        }
+
+        void XcbWindowManager::SendRootMessage(u32 window, u32 type, u32 data0, u32 data1, u32 data2, u32 data3) {
+            xcb_client_message_event_t message = {};
+            message.response_type = XCB_CLIENT_MESSAGE;
+            message.format = 32;
+            message.window = window;
+            message.type = type;
+            message.data.data32[0] = data0;
+            message.data.data32[1] = data1;
+            message.data.data32[2] = data2;
+            message.data.data32[3] = data3;
+            xcb_send_event(mConnection, 0, mRoot, XCB_EVENT_MASK_SUBSTRUCTURE_NOTIFY | XCB_EVENT_MASK_SUBSTRUCTURE_REDIRECT,
+                reinterpret_cast<const char*>(&message));
+        }
+
+        IGamepadInput* XcbWindowManager::GetGamepadInput() {
+            return &mGamepadInput;
+        }
+
+        IWindow* XcbWindowManager::CreateWindow(const WindowInfo& info) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            Logger::Trace(mSink, "Creating window \"{}\" with size {}x{}", info.title, info.width, info.height);
+            XcbWindow* window = new XcbWindow(this, info);
+            mWindows.push_back(window);
+            xcb_flush(mConnection);
+            return window;
+        }
+
+        void XcbWindowManager::DestroyWindow(IWindow*& window) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            ASSERT(dynamic_cast<XcbWindow*>(window) != nullptr, "Type must be of XcbWindow!");
+            Logger::Trace(mSink, "Destroying window \"{}\"", window->GetTitle());
+            XcbWindow* wnd = static_cast<XcbWindow*>(window);
+            if (mFocused == wnd) {
+                mFocused = nullptr;
+            }
+            if (mKeyRelease.window == wnd->GetXcbWindow()) {
+                mKeyRelease.bPending = false;
+            }
+            mWindows.erase(eastl::remove(mWindows.begin(), mWindows.end(), wnd), mWindows.end());
+            delete wnd;
+            mEventStream.Remove(window);
+            UpdateRawMotionSelection();
+            window = nullptr;
+        }
+
+        ICursor* XcbWindowManager::CreateCursor(CursorType type) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            // glyphs of the core cursor font, themed cursors would need libxcb-cursor
+            u16 glyph = XC_left_ptr;
+            switch (type) {
+            case (CursorType::Arrow):
+                glyph = XC_left_ptr;
+                break;
+            case (CursorType::Crosshair):
+                glyph = XC_crosshair;
+                break;
+            case (CursorType::Hand):
+                glyph = XC_hand2;
+                break;
+            case (CursorType::HResize):
+                glyph = XC_sb_h_double_arrow;
+                break;
+            case (CursorType::IBeam):
+                glyph = XC_xterm;
+                break;
+            case (CursorType::NESWResize):
+                glyph = XC_bottom_left_corner;
+                break;
+            case (CursorType::NotAllowed):
+                glyph = XC_X_cursor;
+                break;
+            case (CursorType::NWSEResize):
+                glyph = XC_bottom_right_corner;
+                break;
+            case (CursorType::Resize):
+                glyph = XC_fleur;
+                break;
+            case (CursorType::VResize):
+                glyph = XC_sb_v_double_arrow;
+                break;
+            }
+            if (mCursorFont == 0) {
+                constexpr eastl::string_view kFont = "cursor";
+                mCursorFont = xcb_generate_id(mConnection);
+                xcb_open_font(mConnection, mCursorFont, static_cast<u16>(kFont.size()), kFont.data());
+            }
+            // the mask is the next glyph in the font, black on white
+            const u32 cursor = xcb_generate_id(mConnection);
+            xcb_create_glyph_cursor(mConnection, cursor, mCursorFont, mCursorFont, glyph, glyph + 1, 0, 0, 0, 0xFFFF, 0xFFFF, 0xFFFF);
+            return new XcbCursor(mConnection, cursor);
+        }
+
+        void XcbWindowManager::DestroyCursor(ICursor*& cursor) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            // windows still showing it go back to the default
+            for (XcbWindow* window : mWindows) {
+                if (window->mCursor == cursor) {
+                    window->SetCursor(nullptr);
+                }
+            }
+            delete static_cast<XcbCursor*>(cursor);
+            cursor = nullptr;
+        }
+
+        KeyCode XcbWindowManager::TranslateKey(i32 key, i32 scancode, KeySource source) {
+            ASSERT(bInitialised, "Window manager not initialised!");
+            if (source == KeySource::Physical || scancode < 0 || scancode > 255) {
+                return static_cast<KeyCode>(key);
+            }
+            return mKeyboard.GetLogicalKey(static_cast<u8>(scancode));
+        }
+
+        void XcbWindowManager::InjectLogger(ILogStream* stream) {
+            mSink = stream;
+        }
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,198 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include "XcbKeyboard.hpp"
+#include "XcbMonitor.hpp"
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Forward.hpp>
+#include <PyroPlatform/Window/IWindowManager.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/Input/GamepadInput.hpp>
+#include <PyroPlatform/Window/Input/ServerTimeMapper.hpp>
+
+// libxcb declares its event types as anonymous structs, they can't be forward declared
+#include <xcb/xcb.h>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        class XcbWindow;
+        class XcbWindowInput;
+        // Native X11 backend on XCB, without GLFW or Xlib in between. Events are read in batches, one
+        // read from the socket and then everything libxcb already queued. Nothing on the input path waits
+        // for a reply, the replies window state needs (frame position, WM state) are collected once per
+        // batch. Pointer motion comes from XInput2 with sub-pixel precision, and from XI_RawMotion while a
+        // locked cursor has raw motion enabled. Monitors need RandR 1.3, without it the screen is the only one.
+        // Text input covers Latin-1 and Unicode keysyms without an input method, gamepads come from
+        // IGamepadInput::SetSource().
+        class XcbWindowManager : public IWindowManager, DeleteCopy, DeleteMove {
+        public:
+            // Connects to DISPLAY, fails without an X server
+            bool Init() override;
+            bool Terminate() override;
+
+            void PollEvents() override;
+            void WaitEvents() override;
+            void DrainEvents() override;
+            void InjectClock(IClock* clock) override;
+            WindowEvents& GetEvents() override;
+
+            bool HasClipboardText() override;
+            // Waits up to a second for the owner to convert the selection, incremental transfers are not supported
+            eastl::string GetClipboardText() override;
+            void SetClipboardText(eastl::string_view text) override;
+            eastl::span<IMonitor*> GetMonitors() override;
+            IMonitor* GetPrimaryMonitor() override;
+            IMonitor* GetMonitorForWindow(IWindow* window) override;
+            void RefreshMonitors() override;
+            IGamepadInput* GetGamepadInput() override;
+            IWindow* CreateWindow(const WindowInfo& info) override;
+            void DestroyWindow(IWindow*& window) override;
+            ICursor* CreateCursor(CursorType type) override;
+            void DestroyCursor(ICursor*& cursor) override;
+            // The scancode is the X keycode, the logical key comes from the core keyboard mapping
+            KeyCode TranslateKey(i32 key, i32 scancode, KeySource source) override;
+
+            void InjectLogger(ILogStream* stream) override;
+
+            xcb_connection_t* GetConnection() const {
+                return mConnection;
+            }
+
+        private:
+            friend class XcbWindow;
+            friend class XcbWindowInput;
+            friend class XcbMonitor;
+            friend class XcbPresenter;
+
+            struct Atoms {
+                u32 wmProtocols = 0;
+                u32 wmDeleteWindow = 0;
+                u32 wmState = 0;
+                u32 wmChangeState = 0;
+                u32 netSupported = 0;
+                u32 netWmName = 0;
+                u32 netWmPing = 0;
+                u32 netWmState = 0;
+                u32 netWmStateAbove = 0;
+                u32 netWmStateFullscreen = 0;
+                u32 netWmStateMaximizedVert = 0;
+                u32 netWmStateMaximizedHorz = 0;
+                u32 netWmStateDemandsAttention = 0;
+                u32 netWmStateHidden = 0;
+                u32 netWmWindowOpacity = 0;
+                u32 netActiveWindow = 0;
+                u32 netWorkarea = 0;
+                u32 motifWmHints = 0;
+                u32 utf8String = 0;
+                u32 clipboard = 0;
+                u32 targets = 0;
+                u32 incr = 0;
+                u32 pyroSelection = 0;
+            };
+            struct WorkArea {
+                i32 x = 0;
+                i32 y = 0;
+                i32 width = 0;
+                i32 height = 0;
+            };
+            // A KeyRelease is held back until the next event shows whether it was autorepeat: the
+            // server sends a release and a press with the same keycode and time for every repeat.
+            struct PendingKeyRelease {
+                u32 window = 0;
+                u32 time = 0;
+                u16 state = 0;
+                u8 keycode = 0;
+                bool bPending = false;
+            };
+
+            // Handles the event, then everything already queued behind it
+            void ProcessEvents(xcb_generic_event_t* event);
+            void HandleDeferredEvents();
+            void HandleEvent(xcb_generic_event_t* event);
+            void HandleKey(XcbWindow* window, u8 keycode, u16 state, bool bDown, bool bRepeating, u32 time);
+            // IClock tick for an event, from its X server time where it has one
+            u64 StampEvent(u32 serverTime);
+            void ResetServerTime();
+            void FlushKeyRelease();
+            void HandleSelectionRequest(xcb_generic_event_t* event);
+            void FinishBatch();
+            void FinishPoll();
+            void UpdateMonitors(bool bEmitEvents);
+            void ReadWorkArea();
+            void ReadContentScale();
+            // XI_RawMotion is only selected while a locked cursor wants it
+            void UpdateRawMotionSelection();
+            XcbWindow* FindWindow(u32 window) const;
+            bool IsWmSupported(u32 atom) const;
+            void SendRootMessage(u32 window, u32 type, u32 data0, u32 data1 = 0, u32 data2 = 0, u32 data3 = 0);
+
+            ILogStream* mSink = nullptr;
+            IClock* mClock = nullptr;
+            // arrival counter shared by all windows
+            u64 mEventSequence = 0;
+            ServerTimeMapper mServerTime = {};
+            // stamps never go backwards, InputEventStream orders by them and arrival order has to hold
+            u64 mLastTimestamp = 0;
+            xcb_connection_t* mConnection = nullptr;
+            xcb_screen_t* mScreen = nullptr;
+            u32 mRoot = 0;
+            // input only window that owns the clipboard and receives conversions
+            u32 mHelperWindow = 0;
+            u32 mHiddenCursor = 0;
+            // the core "cursor" font, opened by the first CreateCursor()
+            u32 mCursorFont = 0;
+            Atoms mAtoms = {};
+            eastl::vector<u32> mWmSupported = {};
+            XcbKeyboard mKeyboard = {};
+            PendingKeyRelease mKeyRelease = {};
+            // events that arrived while waiting for a selection, handled on the next poll
+            eastl::vector<xcb_generic_event_t*> mDeferredEvents = {};
+            u8 mXInputOpcode = 0;
+            u8 mRandrEventBase = 0;
+            u8 mShmEventBase = 0;
+            bool bHasXInput = false;
+            bool bHasRandr = false;
+            bool bHasShape = false;
+            bool bHasShm = false;
+            bool bRawMotionSelected = false;
+            FSize mContentScale = { 1.0f, 1.0f };
+            WorkArea mWorkArea = {};
+            eastl::vector<eastl::unique_ptr<XcbMonitor>> mMonitorsStorage;
+            eastl::vector<IMonitor*> mMonitors;
+            u32 mPrimaryOutput = 0;
+            eastl::vector<XcbWindow*> mWindows;
+            XcbWindow* mFocused = nullptr;
+            InputEventStream mEventStream = {};
+            GamepadInput mGamepadInput = {};
+            eastl::string mClipboard = {};
+            bool bOwnsClipboard = false;
+            bool bMonitorsDirty = false;
+            bool bConnectionLost = false;
+            bool bInitialised = false;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Core.hpp>
+#include <PyroPlatform/Window/IWindow.hpp>
+
+namespace PyroshockStudios {
+    inline namespace Platform {
+        // Picks the frame interval for the application's frame pacer. While any tracked window can
+        // be seen frames go out at the normal rate, once all of them are hidden, iconified or fully
+        // covered it drops to the hidden interval. Reads the cached visibility of each window, so
+        // calling it every frame costs nothing, and changes show up after the next PollEvents().
+        class RenderThrottle : DeleteCopy, DeleteMove {
+        public:
+            // 4 frames per second, enough to keep a swapchain and the window manager's ping happy
+            static constexpr f64 kDefaultHiddenInterval = 0.25;
+
+            RenderThrottle() = default;
+
+            // Windows have to be untracked before they are destroyed
+            void Track(IWindow& window) {
+                if (eastl::find(mWindows.begin(), mWindows.end(), &window) == mWindows.end()) {
+                    mWindows.push_back(&window);
+                }
+            }
+            void Untrack(const IWindow& window) {
+                mWindows.erase(eastl::remove(mWindows.begin(), mWindows.end(), &window), mWindows.end());
+            }
+            void SetHiddenInterval(f64 seconds) {
+                mHiddenInterval = seconds;
+            }
+            PYRO_NODISCARD f64 GetHiddenInterval() const {
+                return mHiddenInterval;
+            }
+
+            // True as well with no tracked windows, there is nothing to say they are hidden
+            PYRO_NODISCARD bool IsAnythingVisible() const {
+                if (mWindows.empty()) {
+                    return true;
+                }
+                for (const IWindow* window : mWindows) {
+                    const WindowVisibilityState state = window->GetVisibilityState();
+                    if (state == WindowVisibilityState::Visible || state == WindowVisibilityState::PartiallyObscured) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            // Seconds until the next frame, visibleInterval while something is visible. The hidden
+            // interval never makes frames come faster than visibleInterval would.
+            PYRO_NODISCARD f64 GetFrameInterval(f64 visibleInterval) const {
+                if (IsAnythingVisible()) {
+                    return visibleInterval;
+                }
+                return eastl::max(visibleInterval, mHiddenInterval);
+            }
+
+        private:
+            eastl::vector<const IWindow*> mWindows = {};
+            f64 mHiddenInterval = kDefaultHiddenInterval;
+        };
+    } // namespace Platform
+} // namespace PyroshockStudios
@@ -21,82 +21,333 @@
 // SOFTWARE.
 
 #pragma once
+#include <EASTL/algorithm.h>
 #include <EASTL/array.h>
-#include <EASTL/variant.h>
+#include <EASTL/fixed_function.h>
+#include <EASTL/vector.h>
 
 #include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Time/IClock.hpp>
 #include <PyroPlatform/Window/Input/CharInputEvent.hpp>
 #include <PyroPlatform/Window/Input/CursorEnterEvent.hpp>
 #include <PyroPlatform/Window/Input/CursorPositionEvent.hpp>
 #include <PyroPlatform/Window/Input/CursorScrollEvent.hpp>
 #include <PyroPlatform/Window/Input/InputEventDispatcher.hpp>
+#include <PyroPlatform/Window/Input/InputEventRecord.hpp>
+#include <PyroPlatform/Window/Input/InputEventRegistry.hpp>
+#include <PyroPlatform/Window/Input/InputEventRing.hpp>
 #include <PyroPlatform/Window/Input/KeyEvent.hpp>
+#include <PyroPlatform/Window/Input/LatencyHistogram.hpp>
 #include <PyroPlatform/Window/Input/MouseEvent.hpp>
+#include <PyroPlatform/Window/Input/TextInputEvent.hpp>
 #include <PyroPlatform/Window/Input/Types.hpp>
+#include <PyroPlatform/Window/Input/Utf8.hpp>
 #include <PyroPlatform/Window/Input/WindowCloseEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowContentScaleEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowExposeEvent.hpp>
 #include <PyroPlatform/Window/Input/WindowFocusEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowFramebufferResizeEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowIconifyEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowMaximizeEvent.hpp>
 #include <PyroPlatform/Window/Input/WindowPositionEvent.hpp>
 #include <PyroPlatform/Window/Input/WindowResizeEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowVisibilityEvent.hpp>
 
 namespace PyroshockStudios {
     inline namespace Platform {
         struct IWindowInput;
         class WindowEvents {
         public:
-            using InputEventMap = eastl::array<
-                eastl::variant<
-                    InputEventDispatcher<KeyEvent>,
-                    InputEventDispatcher<MouseEvent>,
-                    InputEventDispatcher<CursorScrollEvent>,
-                    InputEventDispatcher<CursorPositionEvent>,
-                    InputEventDispatcher<CursorEnterEvent>,
-                    InputEventDispatcher<CharInputEvent>,
-                    InputEventDispatcher<WindowCloseEvent>,
-                    InputEventDispatcher<WindowFocusEvent>,
-                    InputEventDispatcher<WindowPositionEvent>,
-                    InputEventDispatcher<WindowResizeEvent>>,
-                static_cast<usize>(InputEventType::COUNT)>;
+            // Dispatchers for the events backends produce. Application defined events are not listed here,
+            // they get a slot in a separate registry the first time they are bound, registered or emitted.
+            using BuiltinEvents = InputEventRegistry<
+                KeyEvent,
+                MouseEvent,
+                CursorScrollEvent,
+                CursorPositionEvent,
+                CursorEnterEvent,
+                CharInputEvent,
+                WindowCloseEvent,
+                WindowFocusEvent,
+                WindowPositionEvent,
+                WindowResizeEvent,
+                TextInputEvent,
+                WindowFramebufferResizeEvent,
+                WindowContentScaleEvent,
+                WindowIconifyEvent,
+                WindowMaximizeEvent,
+                WindowExposeEvent,
+                WindowVisibilityEvent>;
+
+            // sees every record right before it is dispatched, see InputRecorder
+            using RecordObserver = eastl::fixed_function<2 * sizeof(void*), void(const InputEventRecord&)>;
+            // identifies an added observer for removal, 0 is never handed out
+            using RecordObserverHandle = u32;
 
             WindowEvents() = default;
             ~WindowEvents() = default;
 
             template <typename Event>
-            bool BindEvent(const InputEventHandler<Event>& handler) {
-                return GetEventDispatcher<Event>().Bind(handler);
+            PYRO_NODISCARD InputEventHandle<Event> BindEvent(DispatchableEvent<Event>&& fn, i32 priority = 0, InputBindSite site = InputBindSite::current()) {
+                return GetEventDispatcher<Event>().Bind(eastl::move(fn), priority, site);
             }
+
             template <typename Event>
-            PYRO_NODISCARD InputEventHandler<Event> BindEvent(DispatchableEvent<Event>&& fn) {
-                InputEventHandler<Event> handler = InputEventHandler<Event>(eastl::move(fn));
-                GetEventDispatcher<Event>().Bind(handler);
-                return handler;
+            bool UnbindEvent(InputEventHandle<Event> handle) {
+                return GetEventDispatcher<Event>().Unbind(handle);
             }
 
             template <typename Event>
-            bool UnbindEvent(const InputEventHandler<Event>& handler) {
-                return GetEventDispatcher<Event>().Unbind(handler);
+            PYRO_NODISCARD InputEventDispatcher<Event>& GetEventDispatcher() {
+                if constexpr (BuiltinEvents::kContains<Event>) {
+                    return mEvents.template Get<Event>();
+                } else {
+                    return mCustomEvents.template Get<Event>();
+                }
             }
 
+            // Creates the dispatcher for an application defined event ahead of its first use
             template <typename Event>
-            PYRO_NODISCARD InputEventDispatcher<Event>& GetEventDispatcher() {
-                return eastl::get<InputEventDispatcher<Event>>(events[static_cast<usize>(Event::Type)]);
+            void RegisterEvent() {
+                static_assert(!BuiltinEvents::kContains<Event>, "Built in events are always registered!");
+                mCustomEvents.template Register<Event>();
+            }
+            // Dispatches an application defined event to its bound handlers
+            template <typename Event>
+            void Emit(Event& event) {
+                static_assert(!BuiltinEvents::kContains<Event>, "Built in events are dispatched from input records!");
+                GetEventDispatcher<Event>().Dispatch(event);
+            }
+
+            // Latency tracking is off until a clock is set. With a clock, every dispatched record adds
+            // its callback-to-dispatch and dispatch-to-handler-return times to per type histograms.
+            void SetClock(IClock* clock) {
+                mClock = clock;
+                mTickFrequency = clock ? clock->GetTickFrequency() : 0;
+            }
+            PYRO_NODISCARD const LatencyHistogram& GetQueueLatency(InputEventType type) const {
+                return mQueueLatency[static_cast<usize>(type)];
+            }
+            PYRO_NODISCARD const LatencyHistogram& GetHandlerLatency(InputEventType type) const {
+                return mHandlerLatency[static_cast<usize>(type)];
+            }
+            void ResetLatency() {
+                for (LatencyHistogram& histogram : mQueueLatency) {
+                    histogram.Reset();
+                }
+                for (LatencyHistogram& histogram : mHandlerLatency) {
+                    histogram.Reset();
+                }
+            }
+
+            // Observers run in the order they were added. Must not be changed while dispatching.
+            PYRO_NODISCARD RecordObserverHandle AddRecordObserver(RecordObserver&& observer) {
+                const RecordObserverHandle handle = ++mLastObserverHandle;
+                mRecordObservers.push_back({ handle, eastl::move(observer) });
+                return handle;
+            }
+            bool RemoveRecordObserver(RecordObserverHandle handle) {
+                for (auto it = mRecordObservers.begin(); it != mRecordObservers.end(); ++it) {
+                    if (it->handle == handle) {
+                        mRecordObservers.erase(it);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Records of the types a ring wants are pushed into it before the inline handlers run,
+            // see InputEventExecutor. Must not be changed while dispatching.
+            void AttachRing(InputEventRing& ring) {
+                mRings.push_back(&ring);
+            }
+            void DetachRing(InputEventRing& ring) {
+                mRings.erase(eastl::remove(mRings.begin(), mRings.end(), &ring), mRings.end());
+            }
+
+            // Rebuilds the event described by the record and dispatches it to the bound handlers.
+            // CharInput records are also collected into a UTF-8 run that is delivered as a single
+            // TextInputEvent once a record of another type arrives or FlushText() is called.
+            // WindowExpose records are collected until the last of their series, see WindowExposeEvent.
+            void Dispatch(IWindow& sender, const InputEventRecord& record) {
+                for (const ObserverSlot& observer : mRecordObservers) {
+                    observer.fn(record);
+                }
+                for (InputEventRing* ring : mRings) {
+                    if (ring->IsWanted(record.type)) {
+                        ring->Push(sender, record);
+                    }
+                }
+                if (record.type == InputEventType::CharInput) {
+                    AppendText(sender, record);
+                } else if (!mTextRun.empty()) {
+                    FlushText();
+                }
+                if (mClock == nullptr) {
+                    DispatchRecord(sender, record);
+                    return;
+                }
+                const u64 start = mClock->GetTicks();
+                DispatchRecord(sender, record);
+                const u64 end = mClock->GetTicks();
+                if (record.type <= InputEventType::Unknown || record.type >= InputEventType::COUNT) {
+                    return;
+                }
+                const usize index = static_cast<usize>(record.type);
+                if (record.timestamp != 0 && start >= record.timestamp) {
+                    mQueueLatency[index].Record(ToNanoseconds(start - record.timestamp));
+                }
+                mHandlerLatency[index].Record(ToNanoseconds(end - start));
+            }
+
+            // Delivers the pending text run, called by the window manager at the end of every poll
+            void FlushText() {
+                if (mTextRun.empty() || bFlushingText) {
+                    return;
+                }
+                // handlers may type more text, swap so that lands in a fresh run for the next flush
+                eastl::swap(mTextRun, mTextDispatching);
+                const u32 codePoints = mTextCodePoints;
+                mTextCodePoints = 0;
+                bFlushingText = true;
+                DispatchEvent(TextInputEvent(*mTextSender, { mTextDispatching.data(), mTextDispatching.size() }, codePoints), mTextTimestamp);
+                bFlushingText = false;
+                mTextDispatching.clear();
             }
 
         protected:
             friend struct IWindowInput;
 
         private:
-            InputEventMap events = {
-                InputEventDispatcher<KeyEvent>(),
-                InputEventDispatcher<MouseEvent>(),
-                InputEventDispatcher<CursorScrollEvent>(),
-                InputEventDispatcher<CursorPositionEvent>(),
-                InputEventDispatcher<CursorEnterEvent>(),
-                InputEventDispatcher<CharInputEvent>(),
-                InputEventDispatcher<WindowCloseEvent>(),
-                InputEventDispatcher<WindowFocusEvent>(),
-                InputEventDispatcher<WindowPositionEvent>(),
-                InputEventDispatcher<WindowResizeEvent>()
+            struct ObserverSlot {
+                RecordObserverHandle handle;
+                RecordObserver fn;
             };
+
+            void DispatchRecord(IWindow& sender, const InputEventRecord& record) {
+                switch (record.type) {
+                case InputEventType::Key:
+                    DispatchEvent(KeyEvent(sender, record.key.key, record.key.scanCode, record.key.modifiers, record.key.bDown, record.key.bRepeating), record.timestamp);
+                    break;
+                case InputEventType::Mouse:
+                    DispatchEvent(MouseEvent(sender, record.mouse.button, record.mouse.modifiers, record.mouse.bDown), record.timestamp);
+                    break;
+                case InputEventType::CursorScroll:
+                    DispatchEvent(CursorScrollEvent(sender, record.vector.x, record.vector.y), record.timestamp);
+                    break;
+                case InputEventType::CursorPosition:
+                    DispatchEvent(CursorPositionEvent(sender, record.motion.x, record.motion.y, record.motion.deltaX, record.motion.deltaY), record.timestamp);
+                    break;
+                case InputEventType::CursorEnter:
+                    DispatchEvent(CursorEnterEvent(sender, record.toggle.bValue), record.timestamp);
+                    break;
+                case InputEventType::CharInput:
+                    DispatchEvent(CharInputEvent(sender, record.character.unicode), record.timestamp);
+                    break;
+                case InputEventType::WindowClose:
+                    DispatchEvent(WindowCloseEvent(sender), record.timestamp);
+                    break;
+                case InputEventType::WindowFocus:
+                    DispatchEvent(WindowFocusEvent(sender, record.toggle.bValue), record.timestamp);
+                    break;
+                case InputEventType::WindowPosition:
+                    DispatchEvent(WindowPositionEvent(sender, record.vector.x, record.vector.y), record.timestamp);
+                    break;
+                case InputEventType::WindowResize:
+                    DispatchEvent(WindowResizeEvent(sender, record.size.width, record.size.height), record.timestamp);
+                    break;
+                case InputEventType::WindowFramebufferResize:
+                    DispatchEvent(WindowFramebufferResizeEvent(sender, record.size.width, record.size.height), record.timestamp);
+                    break;
+                case InputEventType::WindowContentScale:
+                    DispatchEvent(WindowContentScaleEvent(sender, static_cast<f32>(record.vector.x), static_cast<f32>(record.vector.y)), record.timestamp);
+                    break;
+                case InputEventType::WindowIconify:
+                    DispatchEvent(WindowIconifyEvent(sender, record.toggle.bValue), record.timestamp);
+                    break;
+                case InputEventType::WindowMaximize:
+                    DispatchEvent(WindowMaximizeEvent(sender, record.toggle.bValue), record.timestamp);
+                    break;
+                case InputEventType::WindowExpose:
+                    AppendExpose(sender, record);
+                    break;
+                case InputEventType::WindowVisibility:
+                    DispatchEvent(WindowVisibilityEvent(sender, record.visibility.state), record.timestamp);
+                    break;
+                default:
+                    break;
+                }
+            }
+            void AppendText(IWindow& sender, const InputEventRecord& record) {
+                if (!mTextRun.empty() && mTextSender != &sender) {
+                    FlushText();
+                }
+                if (mTextRun.empty()) {
+                    mTextSender = &sender;
+                    mTextTimestamp = record.timestamp;
+                }
+                char utf8[kMaxUtf8Bytes];
+                const usize length = EncodeUtf8(record.character.unicode, utf8);
+                mTextRun.insert(mTextRun.end(), utf8, utf8 + length);
+                ++mTextCodePoints;
+            }
+            void AppendExpose(IWindow& sender, const InputEventRecord& record) {
+                if (!mExposeRects.empty() && mExposeSender != &sender) {
+                    // series don't interleave, the previous one was cut short
+                    DispatchExpose();
+                }
+                if (mExposeRects.empty()) {
+                    mExposeSender = &sender;
+                    mExposeTimestamp = record.timestamp;
+                }
+                mExposeRects.push_back({ record.rect.x, record.rect.y, record.rect.width, record.rect.height });
+                if (record.rect.remaining == 0) {
+                    DispatchExpose();
+                }
+            }
+            void DispatchExpose() {
+                // handlers may cause more exposure and even get it delivered before they return, the
+                // series being dispatched is moved out of the way so that can't touch it
+                eastl::vector<WindowRect> rects = eastl::move(mExposeRects);
+                mExposeRects.clear();
+                DispatchEvent(WindowExposeEvent(*mExposeSender, { rects.data(), rects.size() }), mExposeTimestamp);
+                // give the storage back unless a nested series is still being collected in it
+                if (mExposeRects.empty() && mExposeRects.capacity() < rects.capacity()) {
+                    rects.clear();
+                    eastl::swap(mExposeRects, rects);
+                }
+            }
+            template <typename Event>
+            void DispatchEvent(Event&& event, u64 timestamp) {
+                event.mTimestamp = timestamp;
+                GetEventDispatcher<Event>().Dispatch(event);
+            }
+            u64 ToNanoseconds(u64 ticks) const {
+                if (mTickFrequency == 1000000000ull) {
+                    return ticks;
+                }
+                return static_cast<u64>(static_cast<f64>(ticks) * 1e9 / static_cast<f64>(mTickFrequency));
+            }
+
+            BuiltinEvents mEvents = {};
+            CustomInputEventRegistry mCustomEvents = {};
+            // both keep their capacity, so typing stops allocating once the longest run has been seen
+            eastl::vector<char> mTextRun = {};
+            eastl::vector<char> mTextDispatching = {};
+            IWindow* mTextSender = nullptr;
+            u64 mTextTimestamp = 0;
+            u32 mTextCodePoints = 0;
+            bool bFlushingText = false;
+            eastl::vector<WindowRect> mExposeRects = {};
+            IWindow* mExposeSender = nullptr;
+            u64 mExposeTimestamp = 0;
+            eastl::vector<InputEventRing*> mRings = {};
+            eastl::vector<ObserverSlot> mRecordObservers = {};
+            RecordObserverHandle mLastObserverHandle = 0;
+            IClock* mClock = nullptr;
+            u64 mTickFrequency = 0;
+            eastl::array<LatencyHistogram, static_cast<usize>(InputEventType::COUNT)> mQueueLatency = {};
+            eastl::array<LatencyHistogram, static_cast<usize>(InputEventType::COUNT)> mHandlerLatency = {};
         };
     } // namespace Platform
 } // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "AllocationCounter.hpp"
+
+#include <EASTL/atomic.h>
+#include <cstdlib>
+#include <new>
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define PYRO_TEST_SANITIZED_MALLOC 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define PYRO_TEST_SANITIZED_MALLOC 1
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(PYRO_TEST_SANITIZED_MALLOC)
+#define PYRO_TEST_HOOKED_MALLOC 1
+
+extern "C" void* __libc_malloc(size_t size);
+
+// every thread in the test binary allocates, the executor and ring tests included
+static eastl::atomic<u64> gAllocationCount = 0;
+
+extern "C" void* malloc(size_t size) {
+    gAllocationCount.fetch_add(1, eastl::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+#endif
+
+u64 AllocationCounter::Count() {
+#ifdef PYRO_TEST_HOOKED_MALLOC
+    return gAllocationCount.load(eastl::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+bool AllocationCounter::IsSupported() {
+    const u64 before = Count();
+    void* volatile memory = ::operator new(64);
+    ::operator delete(memory);
+    return Count() != before;
+}
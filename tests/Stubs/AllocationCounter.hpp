@@ -0,0 +1,14 @@
+#pragma once
+
+#include <PyroCommon/Types.hpp>
+
+using namespace PyroshockStudios::Types;
+
+// Counts heap allocations through the malloc hook in AllocationCounter.cpp, which operator new bottoms out in on glibc.
+// On other runtimes, under sanitizers that bring their own malloc, or when the memory overload does not go through
+// malloc, IsSupported() returns false.
+struct AllocationCounter {
+    // number of allocations made so far by every thread in the process
+    static u64 Count();
+    static bool IsSupported();
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Time/IClock.hpp>
+
+using namespace PyroshockStudios;
+using namespace PyroshockStudios::Platform;
+using namespace PyroshockStudios::Types;
+
+// Manually advanced clock, ticks are nanoseconds and every read advances by `step`
+class ClockStub : public IClock {
+public:
+    u64 ticks = 1000;
+    u64 step = 0;
+
+    f64 GetTimeElapsed() override { return static_cast<f64>(ticks) / 1e9; }
+    void SleepMilliseconds(u32 ms) override { ticks += static_cast<u64>(ms) * 1000000ull; }
+    u64 GetTicks() override {
+        const u64 now = ticks;
+        ticks += step;
+        return now;
+    }
+    u64 GetTickFrequency() override { return 1000000000ull; }
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+#include <PyroCommon/Types.hpp>
+#include <PyroPlatform/Window/IGamepadInput.hpp>
+
+using namespace PyroshockStudios;
+using namespace PyroshockStudios::Platform;
+using namespace PyroshockStudios::Types;
+
+// Fake joysticks, fill in a slot to plug a device in
+class GamepadSourceStub : public IGamepadSource {
+public:
+    struct Device {
+        bool connected = false;
+        const char* guid = "";
+        const char* name = "Stub Pad";
+        eastl::vector<f32> axes;
+        eastl::vector<u8> buttons;
+        eastl::vector<u8> hats;
+        GamepadLayout layout = GamepadLayout::Default;
+    };
+    eastl::array<Device, 4> devices = {};
+
+    u32 GetSlotCount() const override { return static_cast<u32>(devices.size()); }
+    bool QueryDevice(u32 slot, GamepadDeviceState& state) override {
+        const Device& device = devices[slot];
+        if (!device.connected) {
+            return false;
+        }
+        state.guid = device.guid;
+        state.name = device.name;
+        state.axes = { device.axes.data(), device.axes.size() };
+        state.buttons = { device.buttons.data(), device.buttons.size() };
+        state.hats = { device.hats.data(), device.hats.size() };
+        state.layout = device.layout;
+        return true;
+    }
+};
@@ -22,6 +22,7 @@ public:
     f32 dpiScale = 1.0f;
     FSize contentScale{ 1.0f, 1.0f };
     CursorMode cursorMode = CursorMode::Normal;
+    WindowVisibilityState visibility = WindowVisibilityState::Visible;
     bool stickyKeys = false;
     bool stickyMouse = false;
     bool rawMouse = false;
@@ -83,9 +84,14 @@ public:
     bool ShouldClose() const override { return shouldCloseFlag; }
     bool IsFocused() const override { return focused; }
     bool IsHovered() const override { return hovered; }
+    WindowVisibilityState GetVisibilityState() const override { return visibility; }
+
+    void Refresh() override {}
 
     IWindowInput* GetInputHandler() override { return inputHandler; }
 
+    bool PresentPixels(eastl::span<const u8>, Size, u32, eastl::span<const WindowRect>) override { return false; }
+
     NativeHandle GetNativeWindow() const override { return nativeWindow; }
     NativeHandle GetNativeInstance() const override { return nativeInstance; }
 };
@@ -4,14 +4,42 @@
 #include <PyroPlatform/Window/Input/CharInputEvent.hpp>
 #include <PyroPlatform/Window/Input/CursorPositionEvent.hpp>
 #include <PyroPlatform/Window/Input/CursorScrollEvent.hpp>
+#include <PyroPlatform/Window/Input/GamepadInput.hpp>
 #include <PyroPlatform/Window/Input/InputEvent.hpp>
 #include <PyroPlatform/Window/Input/InputEventDispatcher.hpp>
 #include <PyroPlatform/Window/Input/KeyEvent.hpp>
+#include <PyroPlatform/Window/Input/LatencyHistogram.hpp>
 #include <PyroPlatform/Window/Input/MouseEvent.hpp>
+#include <PyroPlatform/Window/Input/ServerTimeMapper.hpp>
+#include <PyroPlatform/Window/Input/TextInputEvent.hpp>
+#include <PyroPlatform/Window/Input/InputEventQueue.hpp>
+#include <PyroPlatform/Window/Input/InputSnapshot.hpp>
+#include <PyroPlatform/Window/Input/WindowExposeEvent.hpp>
 #include <PyroPlatform/Window/Input/WindowResizeEvent.hpp>
+#include <PyroPlatform/Window/Input/WindowVisibilityEvent.hpp>
+#include <PyroPlatform/Window/ActionMap.hpp>
+#include <PyroPlatform/Window/IMonitor.hpp>
+#include <PyroPlatform/Window/InputEventExecutor.hpp>
+#include <PyroPlatform/Window/InputEventStream.hpp>
+#include <PyroPlatform/Window/InputRecording.hpp>
+#include <PyroPlatform/Window/MonitorEvent.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindow.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowInput.hpp>
+#include <PyroPlatform/Window/Platforms/Headless/HeadlessWindowManager.hpp>
+#include <PyroPlatform/Window/RenderThrottle.hpp>
+#ifdef PYRO_PLATFORM_WINDOWING_XCB
+#include <PyroPlatform/Window/Platforms/Xcb/XcbWindowManager.hpp>
+#include <cstdlib>
+#endif
+#include <PyroPlatform/Window/WindowEvents.hpp>
 
+#include "Stubs/AllocationCounter.hpp"
+#include "Stubs/ClockStub.hpp"
+#include "Stubs/GamepadSourceStub.hpp"
 #include "Stubs/WindowStub.hpp"
 
+#include <thread>
+
 using namespace PyroshockStudios;
 using namespace PyroshockStudios::Platform;
 
@@ -29,6 +57,13 @@ TEST(WindowResizeEventTest, ToString) {
     EXPECT_STREQ(event.ToString().c_str(), "Window Resize: (800, 600)");
 }
 
+// -------- WindowResizeEvent --------
+TEST(WindowResizeEventTest, Name) {
+    WindowResizeEvent event(gWindowStub, 800, 600);
+    EXPECT_EQ(event.GetName(), WindowResizeEvent::kName);
+    EXPECT_EQ(event.GetName(), "WindowResizeEvent");
+}
+
 // -------- CharInputEvent --------
 TEST(CharInputEventTest, StoresCharacter) {
     CharInputEvent event(gWindowStub, U'A');
@@ -73,15 +108,46 @@ TEST(KeyEventTest, StoresKeyInfo) {
     EXPECT_EQ(event.kbRepeating, true);
 }
 
+// -------- KeyEvent --------
+TEST(KeyEventTest, FormatToTruncates) {
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyA, 30, {}, true, false);
+    char buffer[8] = {};
+    // the truncation is the point here, going through a volatile keeps GCC's -Wformat-truncation out of it
+    volatile usize capacity = sizeof(buffer);
+    EXPECT_EQ(keyEvent.FormatTo(buffer, capacity), 7u);
+    EXPECT_STREQ(buffer, "Key Cod");
+    EXPECT_EQ(keyEvent.FormatTo(buffer, 0), 0u);
+}
+
+// -------- KeyEvent --------
+TEST(KeyEventTest, LoggingDoesNotAllocate) {
+    if (!AllocationCounter::IsSupported()) {
+        GTEST_SKIP() << "Heap allocations are not observable on this runtime";
+    }
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyA, 30, {}, true, true);
+    const InputEvent<InputEventType::Key>& logged = keyEvent;
+
+    char buffer[KeyEvent::kFormatBufferSize];
+    const u64 before = AllocationCounter::Count();
+    const eastl::string_view name = logged.GetName();
+    const usize length = logged.FormatTo(buffer, sizeof(buffer));
+    const u64 after = AllocationCounter::Count();
+
+    EXPECT_EQ(after, before);
+    EXPECT_EQ(name, "KeyEvent");
+    EXPECT_EQ(eastl::string_view(buffer, length), "Key Code : 65 Down Repeating");
+}
+
 // -------- InputEventDispatcher --------
 TEST(InputEventDispatcherTest, CanAddAndDispatch) {
     InputEventDispatcher<KeyEvent> dispatcher{};
 
     bool called = false;
-    dispatcher.Bind({ [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called = true;
         EXPECT_EQ(evt.kKey, KeyCode::KeyD);
     } });
+    EXPECT_TRUE(handle.Valid());
 
     KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
     dispatcher.Dispatch(keyEvent);
@@ -94,14 +160,14 @@ TEST(InputEventDispatcherTest, CanRemoveAndDispatch) {
     InputEventDispatcher<KeyEvent> dispatcher{};
 
     bool called = false;
-    InputEventHandler<KeyEvent> handler = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called = true;
-    } };
+    } });
 
-    InputEventHandler<KeyEvent> two = handler;
+    InputEventHandle<KeyEvent> two = handle;
 
-    dispatcher.Bind(handler);
-    dispatcher.Unbind(handler);
+    EXPECT_TRUE(dispatcher.Unbind(handle));
+    EXPECT_FALSE(dispatcher.Unbind(two));
 
     KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
     dispatcher.Dispatch(keyEvent);
@@ -115,17 +181,14 @@ TEST(InputEventDispatcherTest, MultipleBinds) {
     InputEventDispatcher<KeyEvent> dispatcher{};
 
     bool called1 = false;
-    InputEventHandler<KeyEvent> handler1 = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle1 = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called1 = true;
-    } };
+    } });
     bool called2 = false;
-    InputEventHandler<KeyEvent> handler2 = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle2 = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called2 = true;
-    } };
-
-
-    dispatcher.Bind(handler1);
-    dispatcher.Bind(handler2);
+    } });
+    EXPECT_FALSE(handle1 == handle2);
 
     KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
     dispatcher.Dispatch(keyEvent);
@@ -138,24 +201,19 @@ TEST(InputEventDispatcherTest, MultipleBindThenUnbind) {
     InputEventDispatcher<KeyEvent> dispatcher{};
 
     bool called1 = false;
-    InputEventHandler<KeyEvent> handler1 = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle1 = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called1 = true;
-    } };
+    } });
     bool called2 = false;
-    InputEventHandler<KeyEvent> handler2 = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle2 = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called2 = true;
-    } };
+    } });
     bool called3 = false;
-    InputEventHandler<KeyEvent> handler3 = { [&](const KeyEvent& evt) {
+    InputEventHandle<KeyEvent> handle3 = dispatcher.Bind({ [&](const KeyEvent& evt) {
         called3 = true;
-    } };
-
-
-    dispatcher.Bind(handler1);
-    dispatcher.Bind(handler2);
-    dispatcher.Bind(handler3);
+    } });
 
-    dispatcher.Unbind(handler2);
+    dispatcher.Unbind(handle2);
 
     KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
     dispatcher.Dispatch(keyEvent);
@@ -164,4 +222,1488 @@ TEST(InputEventDispatcherTest, MultipleBindThenUnbind) {
     EXPECT_TRUE(called3);
 }
 
-#endif
\ No newline at end of file
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, StaleHandleRejectedAfterSlotReuse) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    InputEventHandle<KeyEvent> old = dispatcher.Bind({ [](const KeyEvent&) {} });
+    dispatcher.Unbind(old);
+    InputEventHandle<KeyEvent> reused = dispatcher.Bind({ [](const KeyEvent&) {} });
+
+    EXPECT_EQ(old.GetIndex(), reused.GetIndex());
+    EXPECT_FALSE(dispatcher.IsBound(old));
+    EXPECT_FALSE(dispatcher.Unbind(old));
+    EXPECT_TRUE(dispatcher.IsBound(reused));
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, KeepsBindOrderAcrossCompaction) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    eastl::vector<i32> order;
+    eastl::vector<InputEventHandle<KeyEvent>> handles;
+    for (i32 i = 0; i < 16; ++i) {
+        handles.push_back(dispatcher.Bind({ [&order, i](const KeyEvent&) {
+            order.push_back(i);
+        } }));
+    }
+    // unbind every even handler, enough to trigger a compaction
+    for (i32 i = 0; i < 16; i += 2) {
+        EXPECT_TRUE(dispatcher.Unbind(handles[i]));
+    }
+    EXPECT_EQ(dispatcher.Size(), 8u);
+    for (i32 i = 1; i < 16; i += 2) {
+        EXPECT_TRUE(dispatcher.IsBound(handles[i]));
+    }
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    ASSERT_EQ(order.size(), 8u);
+    for (i32 i = 0; i < 8; ++i) {
+        EXPECT_EQ(order[i], i * 2 + 1);
+    }
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, HandlerCanUnbindItself) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    i32 selfCalls = 0;
+    i32 otherCalls = 0;
+    InputEventHandle<KeyEvent> self = {};
+    self = dispatcher.Bind({ [&](const KeyEvent&) {
+        ++selfCalls;
+        EXPECT_TRUE(dispatcher.Unbind(self));
+    } });
+    InputEventHandle<KeyEvent> other = dispatcher.Bind({ [&](const KeyEvent&) {
+        ++otherCalls;
+    } });
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_EQ(selfCalls, 1);
+    EXPECT_EQ(otherCalls, 2);
+    EXPECT_FALSE(dispatcher.IsBound(self));
+    EXPECT_TRUE(dispatcher.IsBound(other));
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, UnbindLaterHandlerDuringDispatch) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    bool laterCalled = false;
+    InputEventHandle<KeyEvent> later = {};
+    InputEventHandle<KeyEvent> first = dispatcher.Bind({ [&](const KeyEvent&) {
+        dispatcher.Unbind(later);
+    } });
+    later = dispatcher.Bind({ [&](const KeyEvent&) {
+        laterCalled = true;
+    } });
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_FALSE(laterCalled);
+    EXPECT_EQ(dispatcher.Size(), 1u);
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, BindDuringDispatchTakesEffectAfterwards) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    i32 addedCalls = 0;
+    bool bBound = false;
+    InputEventHandle<KeyEvent> added = {};
+    InputEventHandle<KeyEvent> binder = dispatcher.Bind({ [&](const KeyEvent&) {
+        if (bBound) {
+            return;
+        }
+        bBound = true;
+        // enough binds to force the handler storage to grow mid-dispatch
+        for (i32 i = 0; i < 64; ++i) {
+            (void)dispatcher.Bind({ [](const KeyEvent&) {} });
+        }
+        added = dispatcher.Bind({ [&](const KeyEvent&) {
+            ++addedCalls;
+        } });
+        EXPECT_TRUE(dispatcher.IsBound(added));
+    } });
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_EQ(addedCalls, 0);
+    EXPECT_EQ(dispatcher.Size(), 66u);
+
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_EQ(addedCalls, 1);
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, BindThenUnbindDuringDispatch) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    bool addedCalled = false;
+    InputEventHandle<KeyEvent> binder = dispatcher.Bind({ [&](const KeyEvent&) {
+        InputEventHandle<KeyEvent> added = dispatcher.Bind({ [&](const KeyEvent&) {
+            addedCalled = true;
+        } });
+        EXPECT_TRUE(dispatcher.Unbind(added));
+    } });
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_TRUE(dispatcher.Unbind(binder));
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_FALSE(addedCalled);
+    EXPECT_EQ(dispatcher.Size(), 0u);
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, NestedDispatch) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    i32 depth = 0;
+    i32 outerCalls = 0;
+    i32 innerCalls = 0;
+    InputEventHandle<KeyEvent> outer = dispatcher.Bind({ [&](KeyEvent& evt) {
+        ++outerCalls;
+        if (depth++ == 0) {
+            dispatcher.Dispatch(evt);
+            (void)dispatcher.Bind({ [](const KeyEvent&) {} });
+        }
+        --depth;
+    } });
+    InputEventHandle<KeyEvent> inner = dispatcher.Bind({ [&](const KeyEvent&) {
+        ++innerCalls;
+        // unbinding during the nested dispatch must not disturb the outer loop
+        if (innerCalls == 1) {
+            dispatcher.Unbind(outer);
+        }
+    } });
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyD, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_EQ(outerCalls, 2);
+    EXPECT_EQ(innerCalls, 2);
+    EXPECT_FALSE(dispatcher.IsDispatching());
+    EXPECT_EQ(dispatcher.Size(), 2u);
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, RunsHandlersByPriority) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    eastl::vector<i32> order;
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(0); } });
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(1); } }, -5);
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(2); } }, 10);
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(3); } });
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(4); } }, 10);
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyE, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    // highest priority first, bind order within the same priority
+    EXPECT_EQ(order, (eastl::vector<i32>{ 2, 4, 0, 3, 1 }));
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, HandledEventStopsDispatch) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    i32 lowCalls = 0;
+    i32 highCalls = 0;
+    (void)dispatcher.Bind({ [&](const KeyEvent&) { ++lowCalls; } });
+    (void)dispatcher.Bind({ [&](KeyEvent& evt) {
+        ++highCalls;
+        evt.SetHandled();
+    } },
+        1);
+
+    KeyEvent keyEvent(gWindowStub, KeyCode::KeyF, 0, {}, true, false);
+    dispatcher.Dispatch(keyEvent);
+    EXPECT_TRUE(keyEvent.WasHandled());
+    EXPECT_EQ(highCalls, 1);
+    EXPECT_EQ(lowCalls, 0);
+}
+
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, PriorityBindDuringDispatchIsSorted) {
+    InputEventDispatcher<KeyEvent> dispatcher{};
+
+    eastl::vector<i32> order;
+    bool bBound = false;
+    (void)dispatcher.Bind({ [&](const KeyEvent&) {
+        order.push_back(0);
+        if (!bBound) {
+            bBound = true;
+            (void)dispatcher.Bind({ [&](const KeyEvent&) { order.push_back(1); } }, 1);
+        }
+    } });
+
+    KeyEvent first(gWindowStub, KeyCode::KeyG, 0, {}, true, false);
+    dispatcher.Dispatch(first);
+    EXPECT_EQ(order, (eastl::vector<i32>{ 0 }));
+
+    order.clear();
+    KeyEvent second(gWindowStub, KeyCode::KeyG, 0, {}, false, false);
+    dispatcher.Dispatch(second);
+    EXPECT_EQ(order, (eastl::vector<i32>{ 1, 0 }));
+}
+
+// -------- InputEventQueue --------
+TEST(InputEventQueueTest, KeepsArrivalOrder) {
+    InputEventQueue queue(4);
+    queue.Push(InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false));
+    queue.Push(InputEventRecord::CursorPosition(1.0, 2.0));
+    queue.Push(InputEventRecord::Key(KeyCode::KeyA, 0, {}, false, false));
+
+    ASSERT_EQ(queue.Size(), 3u);
+    EXPECT_EQ(queue.Front().type, InputEventType::Key);
+    EXPECT_TRUE(queue.Front().key.bDown);
+    queue.Pop();
+    EXPECT_EQ(queue.Front().type, InputEventType::CursorPosition);
+    EXPECT_DOUBLE_EQ(queue.Front().motion.y, 2.0);
+    queue.Pop();
+    EXPECT_FALSE(queue.Front().key.bDown);
+    queue.Pop();
+    EXPECT_TRUE(queue.Empty());
+}
+
+// -------- InputEventQueue --------
+TEST(InputEventQueueTest, GrowsInsteadOfDropping) {
+    InputEventQueue queue(4);
+    // move the head so the contents wrap around before growing
+    queue.Push(InputEventRecord::CharInput('x'));
+    queue.Pop();
+    for (u32 i = 0; i < 10; ++i) {
+        queue.Push(InputEventRecord::CharInput('a' + i));
+    }
+    EXPECT_EQ(queue.GetOverflowCount(), 2u);
+    EXPECT_EQ(queue.Capacity(), 16u);
+    for (u32 i = 0; i < 10; ++i) {
+        EXPECT_EQ(queue.Front().character.unicode, 'a' + i);
+        queue.Pop();
+    }
+    EXPECT_TRUE(queue.Empty());
+}
+
+// -------- InputEventQueue --------
+TEST(InputEventQueueTest, CoalescesMotionAndScroll) {
+    InputEventQueue queue(8);
+    queue.SetCoalescing(InputEventType::CursorPosition, true);
+    queue.SetCoalescing(InputEventType::CursorScroll, true);
+
+    queue.Push(InputEventRecord::CursorPosition(1.0, 1.0, 1.0, 1.0));
+    queue.Push(InputEventRecord::CursorScroll(0.0, 1.0));
+    queue.Push(InputEventRecord::CursorPosition(3.0, 4.0, 2.0, 3.0));
+    queue.Push(InputEventRecord::CursorScroll(0.0, 2.0));
+
+    ASSERT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.GetMergedCount(InputEventType::CursorPosition), 1u);
+    EXPECT_EQ(queue.GetMergedCount(InputEventType::CursorScroll), 1u);
+    EXPECT_EQ(queue.GetMergedCount(), 2u);
+
+    const InputEventRecord motion = queue.Front();
+    EXPECT_EQ(motion.type, InputEventType::CursorPosition);
+    EXPECT_DOUBLE_EQ(motion.motion.x, 3.0);
+    EXPECT_DOUBLE_EQ(motion.motion.y, 4.0);
+    EXPECT_DOUBLE_EQ(motion.motion.deltaX, 3.0);
+    EXPECT_DOUBLE_EQ(motion.motion.deltaY, 4.0);
+    queue.Pop();
+    EXPECT_DOUBLE_EQ(queue.Front().vector.y, 3.0);
+}
+
+// -------- InputEventQueue --------
+TEST(InputEventQueueTest, CoalescingKeepsKeyOrder) {
+    InputEventQueue queue(8);
+    queue.SetCoalescing(InputEventType::WindowResize, true);
+
+    queue.Push(InputEventRecord::WindowResize(100, 100));
+    queue.Push(InputEventRecord::WindowResize(200, 200));
+    queue.Push(InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false));
+    // the key press is a barrier, the resize after it must not move in front of it
+    queue.Push(InputEventRecord::WindowResize(300, 300));
+    queue.Push(InputEventRecord::WindowResize(400, 400));
+
+    ASSERT_EQ(queue.Size(), 3u);
+    EXPECT_EQ(queue.GetMergedCount(InputEventType::WindowResize), 2u);
+    EXPECT_EQ(queue.Front().size.width, 200u);
+    queue.Pop();
+    EXPECT_EQ(queue.Front().type, InputEventType::Key);
+    queue.Pop();
+    EXPECT_EQ(queue.Front().size.width, 400u);
+
+    // types without coalescing stay untouched
+    queue.Clear();
+    queue.Push(InputEventRecord::CursorPosition(1.0, 1.0));
+    queue.Push(InputEventRecord::CursorPosition(2.0, 2.0));
+    EXPECT_EQ(queue.Size(), 2u);
+}
+
+// -------- InputSnapshot --------
+TEST(InputSnapshotTest, TracksEdgesPerFrame) {
+    InputSnapshot state{};
+    state.Apply(InputEventRecord::Key(KeyCode::KeyW, 0, {}, true, false));
+    state.Apply(InputEventRecord::Key(KeyCode::KeyW, 0, {}, true, true));
+    state.Apply(InputEventRecord::Mouse(MouseButton::Left, InputModifiers::Shift, true));
+
+    InputSnapshot frame = state;
+    EXPECT_TRUE(frame.IsKeyDown(KeyCode::KeyW));
+    EXPECT_TRUE(frame.WasPressed(KeyCode::KeyW));
+    EXPECT_FALSE(frame.WasReleased(KeyCode::KeyW));
+    EXPECT_TRUE(frame.WasPressed(MouseButton::Left));
+    EXPECT_EQ(frame.modifiers, InputModifiers::Shift);
+
+    // held keys survive into the next frame, their edges don't
+    state.ClearFrame();
+    state.Apply(InputEventRecord::Key(KeyCode::KeyW, 0, {}, false, false));
+    frame = state;
+    EXPECT_FALSE(frame.IsKeyDown(KeyCode::KeyW));
+    EXPECT_FALSE(frame.WasPressed(KeyCode::KeyW));
+    EXPECT_TRUE(frame.WasReleased(KeyCode::KeyW));
+    EXPECT_TRUE(frame.IsMouseDown(MouseButton::Left));
+    EXPECT_FALSE(frame.WasPressed(MouseButton::Left));
+}
+
+// -------- InputSnapshot --------
+TEST(InputSnapshotTest, TapWithinOneFrame) {
+    InputSnapshot state{};
+    state.Apply(InputEventRecord::Key(KeyCode::Space, 0, {}, true, false));
+    state.Apply(InputEventRecord::Key(KeyCode::Space, 0, {}, false, false));
+    // unknown keys are reported as -1 and must be ignored
+    state.Apply(InputEventRecord::Key(static_cast<KeyCode>(-1), 0, {}, true, false));
+
+    EXPECT_FALSE(state.IsKeyDown(KeyCode::Space));
+    EXPECT_TRUE(state.WasPressed(KeyCode::Space));
+    EXPECT_TRUE(state.WasReleased(KeyCode::Space));
+    EXPECT_FALSE(state.IsKeyDown(static_cast<KeyCode>(-1)));
+}
+
+// -------- InputSnapshot --------
+TEST(InputSnapshotTest, AccumulatesScroll) {
+    InputSnapshot state{};
+    state.Apply(InputEventRecord::CursorScroll(0.0, 1.0));
+    state.Apply(InputEventRecord::CursorScroll(0.5, 2.0));
+    state.Apply(InputEventRecord::CursorPosition(10.0, 20.0));
+    EXPECT_DOUBLE_EQ(state.scrollX, 0.5);
+    EXPECT_DOUBLE_EQ(state.scrollY, 3.0);
+    EXPECT_DOUBLE_EQ(state.cursorX, 10.0);
+
+    state.ClearFrame();
+    EXPECT_DOUBLE_EQ(state.scrollY, 0.0);
+    EXPECT_DOUBLE_EQ(state.cursorY, 20.0);
+}
+
+// -------- WindowEvents --------
+TEST(WindowEventsTest, DispatchesRecordAsEvent) {
+    WindowEvents events{};
+
+    i32 resized = 0;
+    InputEventHandle<WindowResizeEvent> resizeHandle = events.BindEvent<WindowResizeEvent>([&](const WindowResizeEvent& evt) {
+        ++resized;
+        EXPECT_EQ(evt.kWidth, 640u);
+        EXPECT_EQ(evt.kHeight, 480u);
+    });
+    bool keyCalled = false;
+    InputEventHandle<KeyEvent> keyHandle = events.BindEvent<KeyEvent>([&](const KeyEvent& evt) {
+        keyCalled = true;
+    });
+
+    events.Dispatch(gWindowStub, InputEventRecord::WindowResize(640, 480));
+    EXPECT_EQ(resized, 1);
+    EXPECT_FALSE(keyCalled);
+}
+
+// -------- WindowEvents --------
+TEST(WindowEventsTest, RecordsLatencyPerType) {
+    ClockStub clock{};
+    clock.step = 500;
+    WindowEvents events{};
+    events.SetClock(&clock);
+
+    u64 handlerTimestamp = 0;
+    (void)events.BindEvent<KeyEvent>({ [&](const KeyEvent& evt) { handlerTimestamp = evt.GetTimestamp(); } });
+
+    InputEventRecord record = InputEventRecord::Key(KeyCode::KeyQ, 0, {}, true, false);
+    record.timestamp = 400;
+    clock.ticks = 1400;
+    events.Dispatch(gWindowStub, record);
+
+    EXPECT_EQ(handlerTimestamp, 400u);
+    const LatencyHistogram& queue = events.GetQueueLatency(InputEventType::Key);
+    const LatencyHistogram& handler = events.GetHandlerLatency(InputEventType::Key);
+    ASSERT_EQ(queue.GetCount(), 1u);
+    EXPECT_EQ(queue.GetMax(), 1000u);
+    ASSERT_EQ(handler.GetCount(), 1u);
+    EXPECT_EQ(handler.GetMax(), 500u);
+    EXPECT_EQ(events.GetQueueLatency(InputEventType::Mouse).GetCount(), 0u);
+}
+
+// -------- LatencyHistogram --------
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram{};
+    for (u32 i = 0; i < 99; ++i) {
+        histogram.Record(100);
+    }
+    histogram.Record(1000000);
+
+    EXPECT_EQ(histogram.GetCount(), 100u);
+    EXPECT_EQ(LatencyHistogram::BucketOf(0), 0u);
+    EXPECT_EQ(LatencyHistogram::BucketOf(100), 6u);
+    EXPECT_EQ(histogram.GetBucket(6), 99u);
+    // bucket upper bounds, the last one clamped to the largest sample
+    EXPECT_EQ(histogram.GetPercentile(0.5), 127u);
+    EXPECT_EQ(histogram.GetPercentile(1.0), 1000000u);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), (99.0 * 100.0 + 1000000.0) / 100.0);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetPercentile(0.99), 0u);
+}
+
+// -------- ServerTimeMapper --------
+TEST(ServerTimeMapperTest, UsesLeastDelayedSample) {
+    // microsecond ticks
+    ServerTimeMapper mapper(1000000);
+    // first event read 3ms after the server sent it, the second only 1ms after
+    EXPECT_EQ(mapper.Map(100, 50000), 50000u);
+    EXPECT_EQ(mapper.Map(110, 58000), 58000u);
+    // from now on the 1ms delay sample defines the offset, a late read maps back to send time
+    EXPECT_EQ(mapper.Map(120, 75000), 68000u);
+}
+
+// -------- ServerTimeMapper --------
+TEST(ServerTimeMapperTest, HandlesWraparound) {
+    ServerTimeMapper mapper(1000);
+    const u64 before = mapper.Map(0xFFFFFFF0u, 5000000000ull);
+    const u64 after = mapper.Map(0x10u, 5000000032ull);
+    EXPECT_EQ(after - before, 0x20u);
+}
+
+// -------- InputRecording --------
+TEST(InputRecordingTest, RecordAndReplay) {
+    WindowEvents first{};
+    WindowEvents second{};
+    InputRecorder recorder(1000);
+    EXPECT_EQ(recorder.Attach(first), 0u);
+    EXPECT_EQ(recorder.Attach(second), 1u);
+
+    InputEventRecord press = InputEventRecord::Key(KeyCode::KeyZ, 0, {}, true, false);
+    press.timestamp = 10;
+    InputEventRecord resize = InputEventRecord::WindowResize(640, 480);
+    resize.timestamp = 20;
+    first.Dispatch(gWindowStub, press);
+    second.Dispatch(gWindowStub, resize);
+    recorder.Detach(second);
+    second.Dispatch(gWindowStub, resize);
+    ASSERT_EQ(recorder.GetEntryCount(), 2u);
+
+    InputRecordingView view(recorder.GetBytes());
+    ASSERT_TRUE(view.IsValid());
+    EXPECT_EQ(view.GetHeader().tickFrequency, 1000u);
+    EXPECT_EQ(view.GetEntries()[1].windowId, 1u);
+
+    WindowEvents replayFirst{};
+    WindowEvents replaySecond{};
+    eastl::vector<eastl::string> played;
+    (void)replayFirst.BindEvent<KeyEvent>({ [&](const KeyEvent& evt) { played.push_back(evt.ToString()); } });
+    (void)replaySecond.BindEvent<WindowResizeEvent>({ [&](const WindowResizeEvent& evt) { played.push_back(evt.ToString()); } });
+
+    InputPlayer player(view);
+    player.BindWindow(0, gWindowStub, replayFirst);
+    player.BindWindow(1, gWindowStub, replaySecond);
+    // 5ms after the first entry only the key press is due
+    EXPECT_EQ(player.PlayUntil(0.005), 1u);
+    EXPECT_EQ(player.PlayUntil(0.005), 0u);
+    EXPECT_EQ(player.PlayAll(), 1u);
+    EXPECT_TRUE(player.IsFinished());
+    ASSERT_EQ(played.size(), 2u);
+    EXPECT_EQ(played[0], "Key Code : 90 Down");
+    EXPECT_EQ(played[1], "Window Resize: (640, 480)");
+}
+
+// -------- InputRecording --------
+TEST(InputRecordingTest, RecordersDoNotReplaceEachOther) {
+    WindowEvents events{};
+    InputRecorder first{};
+    InputRecorder second{};
+    i32 observed = 0;
+    const WindowEvents::RecordObserverHandle observer = events.AddRecordObserver({ [&](const InputEventRecord& record) { ++observed; } });
+    (void)first.Attach(events);
+    (void)second.Attach(events);
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false));
+    EXPECT_EQ(first.GetEntryCount(), 1u);
+    EXPECT_EQ(second.GetEntryCount(), 1u);
+    EXPECT_EQ(observed, 1);
+
+    // detaching one recorder only removes its own observer
+    first.Detach(events);
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 0, {}, false, false));
+    EXPECT_EQ(first.GetEntryCount(), 1u);
+    EXPECT_EQ(second.GetEntryCount(), 2u);
+    EXPECT_EQ(observed, 2);
+
+    EXPECT_TRUE(events.RemoveRecordObserver(observer));
+    EXPECT_FALSE(events.RemoveRecordObserver(observer));
+    second.Detach(events);
+}
+
+// -------- InputRecording --------
+TEST(InputRecordingTest, RejectsForeignData) {
+    alignas(8) const u8 bytes[16] = { 'n', 'o', 't', ' ', 'a', ' ', 'l', 'o', 'g' };
+    EXPECT_FALSE(InputRecordingView({ bytes, sizeof(bytes) }).IsValid());
+    EXPECT_FALSE(InputRecordingView({ bytes, 4 }).IsValid());
+}
+
+// -------- ActionMap --------
+TEST(ActionMapTest, ResolvesChords) {
+    constexpr ActionId kSave = 0;
+    constexpr ActionId kMoveForward = 1;
+    constexpr ActionId kFire = 2;
+    ActionMap map{};
+    map.Bind(kSave, ActionBinding::Key(KeyCode::KeyS, InputModifiers::Control));
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::KeyW));
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::Up));
+    map.Bind(kFire, ActionBinding::Mouse(MouseButton::Left));
+
+    EXPECT_EQ(map.Resolve(ActionBinding::Key(KeyCode::KeyS, InputModifiers::Control)).size(), 1u);
+    // exact modifier match, lock keys don't matter
+    EXPECT_TRUE(map.Resolve(ActionBinding::Key(KeyCode::KeyS)).empty());
+    // no chord bound, the plain binding still applies with modifiers held
+    EXPECT_EQ(map.Resolve(ActionBinding::Key(KeyCode::KeyW, InputModifiers::Shift))[0], kMoveForward);
+    EXPECT_EQ(map.Resolve(ActionBinding::Mouse(MouseButton::Left, InputModifiers::Control))[0], kFire);
+    EXPECT_EQ(map.Resolve(ActionBinding::Key(KeyCode::KeyS, InputModifiers::Control | InputModifiers::CapsLock))[0], kSave);
+    EXPECT_EQ(map.Resolve(ActionBinding::Mouse(MouseButton::Left))[0], kFire);
+    EXPECT_TRUE(map.Resolve(ActionBinding::Key(static_cast<KeyCode>(-1))).empty());
+}
+
+// -------- ActionMap --------
+TEST(ActionMapTest, TracksActionState) {
+    constexpr ActionId kSave = 0;
+    constexpr ActionId kMoveForward = 1;
+    WindowEvents events{};
+    ActionMap map{};
+    map.Bind(kSave, ActionBinding::Key(KeyCode::KeyS, InputModifiers::Control));
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::KeyW));
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::Up));
+    map.Attach(events);
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyW, 0, {}, true, false));
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::Up, 0, {}, true, false));
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyW, 0, {}, false, false));
+    EXPECT_TRUE(map.IsDown(kMoveForward));
+    EXPECT_TRUE(map.WasPressed(kMoveForward));
+    EXPECT_FALSE(map.WasReleased(kMoveForward));
+
+    map.ClearFrame();
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::Up, 0, {}, false, false));
+    EXPECT_FALSE(map.IsDown(kMoveForward));
+    EXPECT_TRUE(map.WasReleased(kMoveForward));
+
+    // releasing Control before S still releases the chord it started
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyS, 0, InputModifiers::Control, true, false));
+    EXPECT_TRUE(map.IsDown(kSave));
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyS, 0, {}, false, false));
+    EXPECT_FALSE(map.IsDown(kSave));
+
+    map.Detach();
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyW, 0, {}, true, false));
+    EXPECT_FALSE(map.IsDown(kMoveForward));
+}
+
+// -------- ActionMap --------
+TEST(ActionMapTest, PlainBindingFiresWithModifiersHeld) {
+    constexpr ActionId kMoveForward = 0;
+    constexpr ActionId kSprint = 1;
+    constexpr ActionId kDuplicate = 2;
+    WindowEvents events{};
+    ActionMap map{};
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::KeyW));
+    map.Bind(kSprint, ActionBinding::Key(KeyCode::LeftShift));
+    map.Bind(kDuplicate, ActionBinding::Key(KeyCode::KeyD, InputModifiers::Control));
+    map.Attach(events);
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::LeftShift, 0, InputModifiers::Shift, true, false));
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyW, 0, InputModifiers::Shift, true, false));
+    EXPECT_TRUE(map.IsDown(kSprint));
+    EXPECT_TRUE(map.IsDown(kMoveForward));
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyW, 0, InputModifiers::Shift, false, false));
+    EXPECT_FALSE(map.IsDown(kMoveForward));
+    EXPECT_TRUE(map.WasReleased(kMoveForward));
+
+    // a bound chord still needs its modifiers, D alone is not Ctrl+D
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyD, 0, InputModifiers::Shift, true, false));
+    EXPECT_FALSE(map.IsDown(kDuplicate));
+    map.Detach();
+}
+
+// -------- ActionMap --------
+TEST(ActionMapTest, RebindReleasesHeldActions) {
+    ActionMap map{};
+    map.Bind(0, ActionBinding::Key(KeyCode::Space));
+    map.HandleKey(KeyCode::Space, 0, true, false);
+    EXPECT_TRUE(map.IsDown(0));
+
+    map.Unbind(0);
+    map.Bind(0, ActionBinding::Key(KeyCode::Enter));
+    EXPECT_FALSE(map.IsDown(0));
+    EXPECT_TRUE(map.WasReleased(0));
+    // the old key no longer maps to anything and must not underflow the state
+    map.HandleKey(KeyCode::Space, 0, false, false);
+    map.HandleKey(KeyCode::Enter, 0, true, false);
+    EXPECT_TRUE(map.IsDown(0));
+}
+
+// -------- ActionMap --------
+TEST(ActionMapTest, RebindKeepsUnrelatedHeldActions) {
+    constexpr ActionId kMoveForward = 0;
+    constexpr ActionId kJump = 1;
+    ActionMap map{};
+    map.Bind(kMoveForward, ActionBinding::Key(KeyCode::KeyW));
+    map.Bind(kJump, ActionBinding::Key(KeyCode::Space));
+    map.HandleKey(KeyCode::KeyW, 0, true, false);
+    map.ClearFrame();
+
+    map.Unbind(kJump);
+    map.Bind(kJump, ActionBinding::Key(KeyCode::KeyJ));
+    EXPECT_TRUE(map.IsDown(kMoveForward));
+    EXPECT_FALSE(map.WasPressed(kMoveForward));
+    EXPECT_FALSE(map.WasReleased(kMoveForward));
+    // the release after the rebind still counts
+    map.HandleKey(KeyCode::KeyW, 0, false, false);
+    EXPECT_FALSE(map.IsDown(kMoveForward));
+    EXPECT_TRUE(map.WasReleased(kMoveForward));
+
+    // binding a held key picks it up right away
+    map.HandleKey(KeyCode::KeyE, 0, true, false);
+    map.Bind(kJump, ActionBinding::Key(KeyCode::KeyE));
+    EXPECT_TRUE(map.IsDown(kJump));
+    map.HandleKey(KeyCode::KeyE, 0, false, false);
+    EXPECT_FALSE(map.IsDown(kJump));
+}
+
+// -------- GamepadInput --------
+TEST(GamepadInputTest, ParsesSdlMappings) {
+    GamepadMappingDatabase database{};
+    const u32 added = database.AddMappings(
+        "# comment\n"
+        "03000000de280000ff11000001000000,Steam Virtual Gamepad,a:b0,b:b1,dpup:h0.1,leftx:a0,lefty:a1~,lefttrigger:+a2,righttrigger:a5,\r\n"
+        "\n"
+        "broken line\n"
+        "03000000ffff0000ffff000000000000,Other Platform Pad,a:b0,platform:Nowhere,\n");
+    EXPECT_EQ(added, 1u);
+    EXPECT_EQ(database.Size(), 1u);
+
+    // GUID lookups ignore case
+    const GamepadMapping* mapping = database.Find("03000000DE280000FF11000001000000");
+    ASSERT_NE(mapping, nullptr);
+    EXPECT_EQ(mapping->buttons[static_cast<usize>(GamepadButton::B)].index, 1u);
+    EXPECT_EQ(mapping->buttons[static_cast<usize>(GamepadButton::DpadUp)].type, GamepadMapping::Source::Type::Hat);
+    EXPECT_TRUE(mapping->axes[static_cast<usize>(GamepadAxis::LeftY)].bInvert);
+    EXPECT_EQ(mapping->axes[static_cast<usize>(GamepadAxis::LeftTrigger)].half, 1);
+    EXPECT_EQ(database.Find("03000000ffff0000ffff000000000000"), nullptr);
+}
+
+// -------- GamepadInput --------
+TEST(GamepadInputTest, PollsMappedState) {
+    GamepadSourceStub source{};
+    GamepadSourceStub::Device& pad = source.devices[1];
+    pad.connected = true;
+    pad.guid = "03000000de280000ff11000001000000";
+    pad.axes = { 0.0f, 0.5f, 0.0f, 0.0f, -1.0f, 1.0f };
+    pad.buttons = { 0, 1 };
+    pad.hats = { 1 };
+
+    GamepadInput input(&source);
+    input.AddMappings("03000000de280000ff11000001000000,Steam Virtual Gamepad,a:b1,b:b0,dpup:h0.1,leftx:a0,lefty:a1~,lefttrigger:a4,righttrigger:a5,");
+    input.SetStickDeadzone(0.0f, 1.0f);
+    input.SetTriggerDeadzone(0.0f, 1.0f);
+    input.Poll();
+
+    const GamepadState& state = input.GetState();
+    EXPECT_FALSE(state.IsConnected(0));
+    ASSERT_TRUE(state.IsConnected(1));
+    EXPECT_EQ(input.GetName(1), "Stub Pad");
+    EXPECT_TRUE(state.IsButtonDown(1, GamepadButton::A));
+    EXPECT_TRUE(state.WasPressed(1, GamepadButton::A));
+    EXPECT_FALSE(state.IsButtonDown(1, GamepadButton::B));
+    EXPECT_TRUE(state.IsButtonDown(1, GamepadButton::DpadUp));
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::LeftY), -0.5f);
+    // full range axes driving triggers are rescaled to 0..1
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::LeftTrigger), 0.0f);
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::RightTrigger), 1.0f);
+
+    pad.buttons = { 0, 0 };
+    input.Poll();
+    EXPECT_TRUE(state.WasReleased(1, GamepadButton::A));
+
+    pad.connected = false;
+    input.Poll();
+    EXPECT_FALSE(state.IsConnected(1));
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::LeftY), 0.0f);
+}
+
+// -------- GamepadInput --------
+TEST(GamepadInputTest, AppliesDeadzoneAndCurve) {
+    GamepadSourceStub source{};
+    GamepadSourceStub::Device& pad = source.devices[0];
+    pad.connected = true;
+    // unknown GUID, the Default layout is read as is
+    pad.axes = { 0.05f, 0.05f, 0.6f, 0.0f, 0.0f, 0.0f };
+
+    GamepadInput input(&source);
+    input.SetStickDeadzone(0.2f, 1.0f);
+    input.SetResponseCurve(GamepadResponseCurve::Quadratic);
+    input.Poll();
+
+    const GamepadState& state = input.GetState();
+    EXPECT_FLOAT_EQ(state.GetAxis(0, GamepadAxis::LeftX), 0.0f);
+    EXPECT_FLOAT_EQ(state.GetAxis(0, GamepadAxis::LeftY), 0.0f);
+    // (0.6 - 0.2) / 0.8 = 0.5, squared
+    EXPECT_NEAR(state.GetAxis(0, GamepadAxis::RightX), 0.25f, 1e-6f);
+    EXPECT_FLOAT_EQ(state.GetAxis(0, GamepadAxis::RightY), 0.0f);
+}
+
+// -------- GamepadInput --------
+TEST(GamepadInputTest, UsesBackendMappingAndIgnoresUnknownLayouts) {
+    GamepadSourceStub source{};
+    // mapped by the backend, triggers still arrive as -1..1 and the dpad as buttons
+    GamepadSourceStub::Device& mapped = source.devices[0];
+    mapped.connected = true;
+    mapped.layout = GamepadLayout::Standard;
+    mapped.axes = { 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 1.0f };
+    mapped.buttons.assign(GamepadState::kButtonCount, 0);
+    mapped.buttons[static_cast<usize>(GamepadButton::DpadLeft)] = 1;
+    // evdev order of an Xbox pad (LX, LY, LT, RX, RY, RT), reading it as is would scramble it
+    GamepadSourceStub::Device& raw = source.devices[1];
+    raw.connected = true;
+    raw.guid = "030000005e0400008e02000014010000";
+    raw.layout = GamepadLayout::Unknown;
+    raw.axes = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, -1.0f };
+    raw.buttons = { 1 };
+
+    GamepadInput input(&source);
+    input.SetTriggerDeadzone(0.0f, 1.0f);
+    input.Poll();
+
+    const GamepadState& state = input.GetState();
+    EXPECT_FLOAT_EQ(state.GetAxis(0, GamepadAxis::LeftTrigger), 0.0f);
+    EXPECT_FLOAT_EQ(state.GetAxis(0, GamepadAxis::RightTrigger), 1.0f);
+    EXPECT_TRUE(state.IsButtonDown(0, GamepadButton::DpadLeft));
+
+    // connected but neutral until a mapping shows up
+    ASSERT_TRUE(state.IsConnected(1));
+    EXPECT_FALSE(state.IsButtonDown(1, GamepadButton::A));
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::RightX), 0.0f);
+    input.AddMappings("030000005e0400008e02000014010000,Xbox 360 Controller,a:b0,leftx:a0,lefty:a1,lefttrigger:a2,rightx:a3,righty:a4,righttrigger:a5,");
+    input.Poll();
+    EXPECT_TRUE(state.IsButtonDown(1, GamepadButton::A));
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::LeftTrigger), 1.0f);
+    EXPECT_FLOAT_EQ(state.GetAxis(1, GamepadAxis::RightX), 0.0f);
+}
+
+// -------- TextInputEvent --------
+TEST(TextInputEventTest, BatchesConsecutiveCharacters) {
+    WindowEvents events{};
+
+    eastl::string text{};
+    u32 codePoints = 0;
+    i32 runs = 0;
+    i32 chars = 0;
+    bool bTextBeforeKey = false;
+    (void)events.BindEvent<TextInputEvent>({ [&](const TextInputEvent& evt) {
+        text.assign(evt.kText.data(), evt.kText.size());
+        codePoints = evt.kCodePointCount;
+        ++runs;
+    } });
+    (void)events.BindEvent<CharInputEvent>({ [&](const CharInputEvent& evt) { ++chars; } });
+    (void)events.BindEvent<KeyEvent>({ [&](const KeyEvent& evt) { bTextBeforeKey = runs == 1; } });
+
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('h'));
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput(0xE9));    // e acute
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput(0x20AC));  // euro sign
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput(0x1F600)); // emoji
+    // per code point events still go out straight away
+    EXPECT_EQ(chars, 4);
+    EXPECT_EQ(runs, 0);
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::Enter, 0, {}, true, false));
+    EXPECT_TRUE(bTextBeforeKey);
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(codePoints, 4u);
+    EXPECT_EQ(text, "h\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('!'));
+    events.FlushText();
+    EXPECT_EQ(runs, 2);
+    EXPECT_EQ(text, "!");
+
+    // nothing pending, nothing to deliver
+    events.FlushText();
+    EXPECT_EQ(runs, 2);
+}
+
+// -------- TextInputEvent --------
+TEST(TextInputEventTest, ToStringKeepsLongRuns) {
+    const eastl::string typed(300, 'x');
+    TextInputEvent event(gWindowStub, { typed.data(), typed.size() }, static_cast<u32>(typed.size()));
+    EXPECT_EQ(event.ToString(), "Text Input: " + typed);
+}
+
+// -------- TextInputEvent --------
+TEST(TextInputEventTest, TextTypedDuringDispatchGoesToNextRun) {
+    WindowEvents events{};
+
+    eastl::vector<eastl::string> runs{};
+    (void)events.BindEvent<TextInputEvent>({ [&](const TextInputEvent& evt) {
+        runs.emplace_back(evt.kText.data(), evt.kText.size());
+        if (runs.size() == 1) {
+            events.Dispatch(gWindowStub, InputEventRecord::CharInput('c'));
+            events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::Enter, 0, {}, true, false));
+        }
+    } });
+
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('a'));
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('b'));
+    events.FlushText();
+    ASSERT_EQ(runs.size(), 1u);
+    EXPECT_EQ(runs[0], "ab");
+
+    events.FlushText();
+    ASSERT_EQ(runs.size(), 2u);
+    EXPECT_EQ(runs[1], "c");
+}
+
+// -------- WindowEvents --------
+namespace {
+    struct ScoreChangedEvent {
+        i32 score = 0;
+    };
+} // namespace
+
+TEST(WindowEventsTest, DispatchesCustomEvents) {
+    WindowEvents events{};
+    events.RegisterEvent<ScoreChangedEvent>();
+
+    i32 total = 0;
+    InputEventHandle<ScoreChangedEvent> handle = events.BindEvent<ScoreChangedEvent>({ [&](const ScoreChangedEvent& evt) { total += evt.score; } });
+    ScoreChangedEvent event{ 5 };
+    events.Emit(event);
+    events.Emit(event);
+    EXPECT_EQ(total, 10);
+
+    // other windows keep their own dispatchers for the same type
+    WindowEvents other{};
+    other.Emit(event);
+    EXPECT_EQ(total, 10);
+
+    EXPECT_TRUE(events.UnbindEvent(handle));
+    events.Emit(event);
+    EXPECT_EQ(total, 10);
+}
+
+// -------- InputEventStream --------
+TEST(InputEventStreamTest, MergesWindowsByTimestamp) {
+    WindowStub first{};
+    WindowStub second{};
+    InputEventStream stream{};
+
+    eastl::vector<eastl::pair<IWindow*, u64>> seen{};
+    (void)stream.GetEvents().BindEvent<KeyEvent>({ [&](KeyEvent& evt) { seen.push_back({ evt.Sender(), evt.GetTimestamp() }); } });
+
+    const auto key = [](u64 timestamp, u64 sequence) {
+        InputEventRecord record = InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false);
+        record.timestamp = timestamp;
+        record.sequence = sequence;
+        return record;
+    };
+    stream.Push(first, key(10, 0));
+    stream.Push(second, key(30, 2));
+    stream.Push(first, key(20, 1));
+    stream.Push(second, key(20, 3));
+    EXPECT_EQ(stream.GetPendingCount(), 4u);
+
+    stream.Dispatch();
+    ASSERT_EQ(seen.size(), 4u);
+    EXPECT_EQ(seen[0].first, &first);
+    EXPECT_EQ(seen[0].second, 10u);
+    EXPECT_EQ(seen[1].first, &first);
+    EXPECT_EQ(seen[1].second, 20u);
+    EXPECT_EQ(seen[2].first, &second);
+    EXPECT_EQ(seen[2].second, 20u);
+    EXPECT_EQ(seen[3].first, &second);
+    EXPECT_EQ(seen[3].second, 30u);
+    EXPECT_EQ(stream.GetPendingCount(), 0u);
+}
+
+// -------- InputEventStream --------
+TEST(InputEventStreamTest, DropsRemovedWindows) {
+    WindowStub first{};
+    WindowStub second{};
+    InputEventStream stream{};
+
+    i32 fromSecond = 0;
+    (void)stream.GetEvents().BindEvent<WindowCloseEvent>({ [&](WindowCloseEvent& evt) {
+        if (evt.Sender() == &second) {
+            ++fromSecond;
+        }
+        // closing the first window takes the second down with it
+        stream.Remove(&second);
+    } });
+
+    stream.Push(first, InputEventRecord::WindowClose());
+    stream.Push(second, InputEventRecord::WindowClose());
+    stream.Dispatch();
+    EXPECT_EQ(fromSecond, 0);
+}
+
+// -------- InputEventExecutor --------
+TEST(InputEventExecutorTest, DefersOffloadedHandlers) {
+    WindowEvents events{};
+    InputEventExecutor executor("analytics");
+
+    i32 inlineKeys = 0;
+    i32 offloadedKeys = 0;
+    eastl::string text{};
+    (void)events.BindEvent<KeyEvent>({ [&](const KeyEvent& evt) { ++inlineKeys; } });
+    (void)executor.BindEvent<KeyEvent>({ [&](KeyEvent& evt) {
+        EXPECT_EQ(evt.Sender(), &gWindowStub);
+        ++offloadedKeys;
+    } });
+    (void)executor.BindEvent<TextInputEvent>({ [&](const TextInputEvent& evt) { text.append(evt.kText.data(), evt.kText.size()); } });
+    executor.Attach(events);
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false));
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('a'));
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('b'));
+    // nothing bound for these, they never reach the ring
+    events.Dispatch(gWindowStub, InputEventRecord::CursorPosition(1.0, 2.0));
+    EXPECT_EQ(inlineKeys, 1);
+    EXPECT_EQ(offloadedKeys, 0);
+    EXPECT_EQ(executor.GetRing().GetPendingCount(), 3u);
+
+    EXPECT_EQ(executor.Run(), 3u);
+    EXPECT_EQ(offloadedKeys, 1);
+    EXPECT_EQ(text, "ab");
+
+    executor.Detach(events);
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 0, {}, false, false));
+    EXPECT_EQ(executor.Run(), 0u);
+    EXPECT_EQ(inlineKeys, 2);
+}
+
+// -------- InputEventExecutor --------
+TEST(InputEventExecutorTest, StopsCopyingUnboundTypes) {
+    WindowEvents events{};
+    InputEventExecutor executor("logging");
+    const InputEventHandle<KeyEvent> first = executor.BindEvent<KeyEvent>({ [](const KeyEvent& evt) {} });
+    const InputEventHandle<KeyEvent> second = executor.BindEvent<KeyEvent>({ [](const KeyEvent& evt) {} });
+    const InputEventHandle<TextInputEvent> text = executor.BindEvent<TextInputEvent>({ [](const TextInputEvent& evt) {} });
+    const InputEventHandle<CharInputEvent> chars = executor.BindEvent<CharInputEvent>({ [](const CharInputEvent& evt) {} });
+    executor.Attach(events);
+
+    EXPECT_TRUE(executor.UnbindEvent(first));
+    EXPECT_FALSE(executor.UnbindEvent(first));
+    EXPECT_TRUE(executor.GetRing().IsWanted(InputEventType::Key));
+    EXPECT_TRUE(executor.UnbindEvent(second));
+    EXPECT_FALSE(executor.GetRing().IsWanted(InputEventType::Key));
+    // text runs and single characters both come from character records
+    EXPECT_TRUE(executor.UnbindEvent(text));
+    EXPECT_TRUE(executor.GetRing().IsWanted(InputEventType::CharInput));
+    EXPECT_TRUE(executor.UnbindEvent(chars));
+    EXPECT_FALSE(executor.GetRing().IsWanted(InputEventType::CharInput));
+
+    events.Dispatch(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 0, {}, true, false));
+    events.Dispatch(gWindowStub, InputEventRecord::CharInput('a'));
+    EXPECT_EQ(executor.GetRing().GetPendingCount(), 0u);
+    executor.Detach(events);
+}
+
+// -------- InputEventExecutor --------
+TEST(InputEventExecutorTest, DropsWhenFull) {
+    InputEventRing ring(4);
+    ring.Want(InputEventType::Key);
+    for (i32 i = 0; i < 6; ++i) {
+        ring.Push(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, i, {}, true, false));
+    }
+    EXPECT_EQ(ring.GetPendingCount(), 4u);
+    EXPECT_EQ(ring.GetDroppedCount(), 2u);
+
+    InputEventRing::Entry entry{};
+    ASSERT_TRUE(ring.Pop(entry));
+    EXPECT_EQ(entry.record.key.scanCode, 0);
+    EXPECT_TRUE(ring.Push(gWindowStub, InputEventRecord::Key(KeyCode::KeyA, 6, {}, true, false)));
+    i32 last = 0;
+    while (ring.Pop(entry)) {
+        last = entry.record.key.scanCode;
+    }
+    EXPECT_EQ(last, 6);
+    EXPECT_FALSE(ring.IsWanted(InputEventType::Mouse));
+    EXPECT_FALSE(ring.IsWanted(InputEventType::Unknown));
+}
+
+// -------- WindowEvents --------
+TEST(WindowEventsTest, DispatchesWindowStateEvents) {
+    WindowEvents events{};
+
+    Size framebuffer{};
+    FSize scale{};
+    bool bIconified = false;
+    bool bMaximized = false;
+    (void)events.BindEvent<WindowFramebufferResizeEvent>({ [&](const WindowFramebufferResizeEvent& evt) { framebuffer = Size(evt.kWidth, evt.kHeight); } });
+    (void)events.BindEvent<WindowContentScaleEvent>({ [&](const WindowContentScaleEvent& evt) { scale = FSize(evt.kX, evt.kY); } });
+    (void)events.BindEvent<WindowIconifyEvent>({ [&](const WindowIconifyEvent& evt) { bIconified = evt.kbIconified; } });
+    (void)events.BindEvent<WindowMaximizeEvent>({ [&](const WindowMaximizeEvent& evt) { bMaximized = evt.kbMaximized; } });
+
+    events.Dispatch(gWindowStub, InputEventRecord::WindowFramebufferResize(2560, 1440));
+    events.Dispatch(gWindowStub, InputEventRecord::WindowContentScale(2.0, 2.0));
+    events.Dispatch(gWindowStub, InputEventRecord::WindowIconify(true));
+    events.Dispatch(gWindowStub, InputEventRecord::WindowMaximize(true));
+
+    EXPECT_EQ(framebuffer.width, 2560u);
+    EXPECT_EQ(framebuffer.height, 1440u);
+    EXPECT_FLOAT_EQ(scale.width, 2.0f);
+    EXPECT_FLOAT_EQ(scale.height, 2.0f);
+    EXPECT_TRUE(bIconified);
+    EXPECT_TRUE(bMaximized);
+
+    // a live resize only needs the last framebuffer size
+    InputEventQueue queue{};
+    queue.SetCoalescing(InputEventType::WindowFramebufferResize, true);
+    queue.Push(InputEventRecord::WindowFramebufferResize(800, 600));
+    queue.Push(InputEventRecord::WindowFramebufferResize(1024, 768));
+    ASSERT_EQ(queue.Size(), 1u);
+    EXPECT_EQ(queue.Front().size.width, 1024u);
+}
+
+// -------- WindowEvents --------
+TEST(WindowEventsTest, DeliversExposeSeriesTogether) {
+    WindowEvents events{};
+
+    eastl::vector<WindowRect> rects{};
+    WindowRect bounds{};
+    u32 dispatches = 0;
+    (void)events.BindEvent<WindowExposeEvent>({ [&](const WindowExposeEvent& evt) {
+        rects.assign(evt.kRects.begin(), evt.kRects.end());
+        bounds = evt.kBounds;
+        ++dispatches;
+    } });
+
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(10, 10, 20, 20, 2));
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(100, 0, 10, 5, 1));
+    EXPECT_EQ(dispatches, 0u);
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(0, 50, 5, 5, 0));
+    ASSERT_EQ(dispatches, 1u);
+    ASSERT_EQ(rects.size(), 3u);
+    EXPECT_EQ(rects[1], (WindowRect{ 100, 0, 10, 5 }));
+    EXPECT_EQ(bounds, (WindowRect{ 0, 0, 110, 55 }));
+
+    // a lone rectangle goes out right away
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(0, 0, 640, 480));
+    EXPECT_EQ(dispatches, 2u);
+    EXPECT_EQ(rects.size(), 1u);
+}
+
+// -------- WindowEvents --------
+TEST(WindowEventsTest, ExposeHandlerCanCauseMoreExposure) {
+    WindowEvents events{};
+
+    eastl::vector<WindowRect> outer{};
+    eastl::vector<WindowRect> nested{};
+    (void)events.BindEvent<WindowExposeEvent>({ [&](const WindowExposeEvent& evt) {
+        if (evt.kRects.size() == 1) {
+            nested.assign(evt.kRects.begin(), evt.kRects.end());
+            return;
+        }
+        // redrawing exposes another complete series before this handler returns
+        events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(7, 7, 1, 1));
+        outer.assign(evt.kRects.begin(), evt.kRects.end());
+    } });
+
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(10, 10, 20, 20, 1));
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(100, 0, 10, 5, 0));
+    ASSERT_EQ(nested.size(), 1u);
+    EXPECT_EQ(nested[0], (WindowRect{ 7, 7, 1, 1 }));
+    ASSERT_EQ(outer.size(), 2u);
+    EXPECT_EQ(outer[0], (WindowRect{ 10, 10, 20, 20 }));
+    EXPECT_EQ(outer[1], (WindowRect{ 100, 0, 10, 5 }));
+
+    // neither series is left behind in the next one
+    nested.clear();
+    events.Dispatch(gWindowStub, InputEventRecord::WindowExpose(0, 0, 640, 480));
+    ASSERT_EQ(nested.size(), 1u);
+    EXPECT_EQ(nested[0], (WindowRect{ 0, 0, 640, 480 }));
+}
+
+// -------- RefreshRate --------
+TEST(RefreshRateTest, DerivesExactRateFromModeTimings) {
+    // CEA 1080p at 59.94 Hz: 148.5 MHz / 1.001 over 2200 x 1125
+    const RefreshRate ntsc = RefreshRate::FromModeTimings(148351648, 2200, 1125, false, false);
+    EXPECT_NEAR(ntsc.GetHertz(), 59.94, 1e-3);
+    // XRandR reports the dot clock in whole hertz, the fraction keeps what it was given exactly
+    EXPECT_EQ(static_cast<u64>(ntsc.numerator) * 2200 * 1125, static_cast<u64>(ntsc.denominator) * 148351648);
+
+    const RefreshRate exact = RefreshRate::FromModeTimings(148500000, 2200, 1125, false, false);
+    EXPECT_EQ(exact, RefreshRate::FromHertz(60));
+
+    // 1080i shows two fields per frame, double scan repeats every line
+    EXPECT_EQ(RefreshRate::FromModeTimings(74250000, 2200, 1125, true, false), RefreshRate::FromHertz(60));
+    EXPECT_EQ(RefreshRate::FromModeTimings(148500000, 2200, 1125, false, true), RefreshRate::FromHertz(30));
+
+    EXPECT_FALSE(RefreshRate::FromModeTimings(0, 2200, 1125, false, false).IsValid());
+    EXPECT_FALSE(RefreshRate::FromModeTimings(148500000, 0, 1125, false, false).IsValid());
+}
+
+#ifndef PYRO_PLATFORM_DUMMY_INTERFACE
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, InjectedInputTakesThePlatformPath) {
+    ClockStub clock{};
+    HeadlessWindowManager manager{};
+    manager.InjectClock(&clock);
+    ASSERT_TRUE(manager.Init());
+    IWindow* window = manager.CreateWindow({ 640, 480, "Headless" });
+    HeadlessWindowInput* input = static_cast<HeadlessWindow*>(window)->GetHeadlessInput();
+    EXPECT_TRUE(window->IsFocused());
+
+    i32 windowKeys = 0;
+    i32 streamKeys = 0;
+    IWindow* sender = nullptr;
+    eastl::string text{};
+    (void)input->GetEvents().BindEvent<KeyEvent>({ [&](const KeyEvent& evt) { ++windowKeys; } });
+    (void)input->GetEvents().BindEvent<TextInputEvent>({ [&](const TextInputEvent& evt) { text.append(evt.kText.data(), evt.kText.size()); } });
+    (void)manager.GetEvents().BindEvent<KeyEvent>({ [&](KeyEvent& evt) {
+        ++streamKeys;
+        sender = evt.Sender();
+    } });
+
+    input->InjectKey(KeyCode::KeyA, true);
+    input->InjectText("h\xC3\xA9llo");
+    // the window dispatches right away, the stream and the snapshot wait for the poll
+    EXPECT_EQ(windowKeys, 1);
+    EXPECT_EQ(streamKeys, 0);
+    EXPECT_FALSE(input->IsKeyDown(KeyCode::KeyA));
+
+    manager.PollEvents();
+    EXPECT_EQ(streamKeys, 1);
+    EXPECT_EQ(sender, window);
+    EXPECT_EQ(text, "h\xC3\xA9llo");
+    EXPECT_TRUE(input->IsKeyDown(KeyCode::KeyA));
+    EXPECT_TRUE(input->WasPressed(KeyCode::KeyA));
+
+    f64 deltaX = -1.0;
+    f64 deltaY = -1.0;
+    (void)input->GetEvents().BindEvent<CursorPositionEvent>({ [&](const CursorPositionEvent& evt) {
+        deltaX = evt.kDeltaX;
+        deltaY = evt.kDeltaY;
+    } });
+    // the first motion has no previous position, it must not report the absolute position as movement
+    input->InjectCursorPosition(10.0, 20.0);
+    EXPECT_EQ(window->GetCursorPosition().x, 10);
+    EXPECT_EQ(window->GetCursorPosition().y, 20);
+    EXPECT_DOUBLE_EQ(deltaX, 0.0);
+    EXPECT_DOUBLE_EQ(deltaY, 0.0);
+    // dragged out past the left edge, the cache clamps while the snapshot keeps the real position
+    input->InjectCursorPosition(-15.5, 30.0);
+    EXPECT_EQ(window->GetCursorPosition().x, 0);
+    EXPECT_EQ(window->GetCursorPosition().y, 30);
+    EXPECT_DOUBLE_EQ(deltaX, -25.5);
+    EXPECT_DOUBLE_EQ(deltaY, 10.0);
+    // the cursor moved while it was outside, entering starts over
+    input->InjectCursorEnter(false);
+    input->InjectCursorEnter(true);
+    input->InjectCursorPosition(300.0, 200.0);
+    EXPECT_DOUBLE_EQ(deltaX, 0.0);
+    EXPECT_DOUBLE_EQ(deltaY, 0.0);
+    input->InjectCursorPosition(301.0, 198.0);
+    EXPECT_DOUBLE_EQ(deltaX, 1.0);
+    EXPECT_DOUBLE_EQ(deltaY, -2.0);
+    input->InjectCursorPosition(-15.5, 30.0);
+    manager.PollEvents();
+    EXPECT_DOUBLE_EQ(input->GetSnapshot().cursorX, -15.5);
+
+    manager.DestroyWindow(window);
+    EXPECT_TRUE(manager.Terminate());
+}
+
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, SnapshotCanBeReadFromAnotherThread) {
+    HeadlessWindowManager manager{};
+    ASSERT_TRUE(manager.Init());
+    IWindow* window = manager.CreateWindow({ 640, 480, "Headless" });
+    HeadlessWindowInput* input = static_cast<HeadlessWindow*>(window)->GetHeadlessInput();
+
+    // every published frame keeps cursorY == 2 * cursorX == 2 * scrollX, and W is held on odd frames,
+    // a copy mixing two publishes breaks one of those
+    constexpr i32 kFrames = 20000;
+    eastl::atomic<bool> bStarted = false;
+    eastl::atomic<bool> bDone = false;
+    i32 torn = 0;
+    i32 reads = 0;
+    std::thread reader([&] {
+        bStarted.store(true, eastl::memory_order_release);
+        while (!bDone.load(eastl::memory_order_acquire)) {
+            const InputSnapshot snapshot = input->GetSnapshot();
+            const i32 frame = static_cast<i32>(snapshot.cursorX);
+            if (snapshot.cursorY != 2.0 * snapshot.cursorX || snapshot.scrollX != snapshot.cursorX ||
+                snapshot.IsKeyDown(KeyCode::KeyW) != ((frame & 1) != 0)) {
+                ++torn;
+            }
+            ++reads;
+        }
+    });
+    while (!bStarted.load(eastl::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    for (i32 frame = 1; frame <= kFrames; ++frame) {
+        input->InjectCursorPosition(frame, 2.0 * frame);
+        input->InjectScroll(frame, 0.0);
+        input->InjectKey(KeyCode::KeyW, (frame & 1) != 0);
+        manager.PollEvents();
+    }
+    bDone.store(true, eastl::memory_order_release);
+    reader.join();
+    EXPECT_EQ(torn, 0);
+    EXPECT_GT(reads, 0);
+    EXPECT_DOUBLE_EQ(input->GetSnapshot().cursorX, kFrames);
+
+    manager.DestroyWindow(window);
+    EXPECT_TRUE(manager.Terminate());
+}
+
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, StateChangesUpdateCacheAndSendEvents) {
+    HeadlessWindowManager manager{};
+    ASSERT_TRUE(manager.Init());
+    WindowInfo info{ 800, 600, "HiDPI" };
+    info.flags = WindowCreateBits::DEFAULT | WindowCreateBits::HIGH_DPI;
+    auto* first = static_cast<HeadlessWindow*>(manager.CreateWindow(info));
+    WindowEvents& events = first->GetInputHandler()->GetEvents();
+
+    Size resized{};
+    Size framebuffer{};
+    bool bIconified = false;
+    i32 focusChanges = 0;
+    (void)events.BindEvent<WindowResizeEvent>({ [&](const WindowResizeEvent& evt) { resized = Size(evt.kWidth, evt.kHeight); } });
+    (void)events.BindEvent<WindowFramebufferResizeEvent>({ [&](const WindowFramebufferResizeEvent& evt) { framebuffer = Size(evt.kWidth, evt.kHeight); } });
+    (void)events.BindEvent<WindowIconifyEvent>({ [&](const WindowIconifyEvent& evt) { bIconified = evt.kbIconified; } });
+    (void)events.BindEvent<WindowFocusEvent>({ [&](const WindowFocusEvent& evt) { ++focusChanges; } });
+
+    first->SetSize(Size(1024, 768));
+    EXPECT_EQ(first->GetSize().width, 1024u);
+    EXPECT_EQ(resized.width, 1024u);
+    EXPECT_EQ(framebuffer.width, 1024u);
+
+    first->InjectContentScale(FSize(2.0f, 2.0f));
+    EXPECT_EQ(first->GetFramebufferSize().width, 2048u);
+    EXPECT_EQ(framebuffer.height, 1536u);
+    EXPECT_FLOAT_EQ(first->GetDPIScale(), 2.0f);
+
+    first->Minimize();
+    EXPECT_TRUE(first->IsMinimized());
+    EXPECT_TRUE(bIconified);
+    first->Restore();
+    EXPECT_FALSE(bIconified);
+
+    // focus moves to the newest window
+    IWindow* second = manager.CreateWindow({ 320, 240, "Second" });
+    EXPECT_EQ(focusChanges, 1);
+    EXPECT_FALSE(first->IsFocused());
+    EXPECT_TRUE(second->IsFocused());
+    EXPECT_EQ(manager.GetFocusedWindow(), second);
+
+    first->InjectCloseRequest();
+    EXPECT_TRUE(first->ShouldClose());
+    EXPECT_EQ(manager.GetMonitorForWindow(first), manager.GetPrimaryMonitor());
+
+    EXPECT_TRUE(manager.Terminate());
+}
+
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, EmitsMonitorEvents) {
+    HeadlessWindowManager manager{};
+    ASSERT_TRUE(manager.Init());
+    ASSERT_EQ(manager.GetMonitors().size(), 1u);
+
+    eastl::vector<MonitorEventType> seen{};
+    (void)manager.GetEvents().BindEvent<MonitorEvent>({ [&](const MonitorEvent& evt) { seen.push_back(evt.kType); } });
+
+    HeadlessMonitorInfo info{};
+    info.name = "Second";
+    info.position = Point(1920, 0);
+    HeadlessMonitor* monitor = manager.ConnectMonitor(info);
+    EXPECT_EQ(manager.GetMonitors().size(), 2u);
+
+    info.currentMode.refreshRate = 144;
+    manager.UpdateMonitor(monitor, info);
+    // cached until the manager notices
+    EXPECT_EQ(monitor->GetRefreshRate(), 60u);
+    manager.PollEvents();
+    EXPECT_EQ(monitor->GetRefreshRate(), 144u);
+    EXPECT_EQ(monitor->GetPreciseRefreshRate(), RefreshRate::FromHertz(144));
+
+    manager.DisconnectMonitor(monitor);
+    EXPECT_EQ(manager.GetMonitors().size(), 1u);
+    ASSERT_EQ(seen.size(), 3u);
+    EXPECT_EQ(seen[0], MonitorEventType::Connected);
+    EXPECT_EQ(seen[1], MonitorEventType::Changed);
+    EXPECT_EQ(seen[2], MonitorEventType::Disconnected);
+
+    EXPECT_TRUE(manager.Terminate());
+}
+
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, PresentsOnlyDirtyRects) {
+    HeadlessWindowManager manager{};
+    ASSERT_TRUE(manager.Init());
+    auto* window = static_cast<HeadlessWindow*>(manager.CreateWindow({ 4, 3, "Pixels" }));
+
+    // padded rows, the stride is larger than the image
+    constexpr u32 kStride = 6 * 4;
+    eastl::vector<u32> image(6 * 3, 0xFF0000u);
+    const auto bytes = [&]() { return eastl::span<const u8>(reinterpret_cast<const u8*>(image.data()), image.size() * 4); };
+    EXPECT_TRUE(window->PresentPixels(bytes(), Size(4, 3), kStride));
+    ASSERT_EQ(window->GetPresentedRects().size(), 1u);
+    EXPECT_EQ(window->GetPresentedRects()[0], (WindowRect{ 0, 0, 4, 3 }));
+    EXPECT_EQ(window->GetPresentedPixels()[11], 0xFF0000u);
+
+    for (u32& pixel : image) {
+        pixel = 0x00FF00u;
+    }
+    // partly outside, clipped to the image, and an empty one that is skipped
+    const WindowRect dirty[] = { { 2, 1, 5, 5 }, { 0, 0, 0, 2 } };
+    EXPECT_TRUE(window->PresentPixels(bytes(), Size(4, 3), kStride, dirty));
+    ASSERT_EQ(window->GetPresentedRects().size(), 1u);
+    EXPECT_EQ(window->GetPresentedRects()[0], (WindowRect{ 2, 1, 2, 2 }));
+    eastl::span<const u32> presented = window->GetPresentedPixels();
+    EXPECT_EQ(presented[0], 0xFF0000u);
+    EXPECT_EQ(presented[1 * 4 + 1], 0xFF0000u);
+    EXPECT_EQ(presented[1 * 4 + 2], 0x00FF00u);
+    EXPECT_EQ(presented[2 * 4 + 3], 0x00FF00u);
+
+    IWindow* base = window;
+    manager.DestroyWindow(base);
+    EXPECT_TRUE(manager.Terminate());
+}
+
+// -------- HeadlessWindowManager --------
+TEST(HeadlessWindowManagerTest, TracksVisibilityAndThrottlesRendering) {
+    HeadlessWindowManager manager{};
+    ASSERT_TRUE(manager.Init());
+    auto* first = static_cast<HeadlessWindow*>(manager.CreateWindow({ 320, 240, "First" }));
+    auto* second = static_cast<HeadlessWindow*>(manager.CreateWindow({ 320, 240, "Second" }));
+    EXPECT_EQ(first->GetVisibilityState(), WindowVisibilityState::Visible);
+
+    eastl::vector<WindowVisibilityState> seen{};
+    (void)first->GetInputHandler()->GetEvents().BindEvent<WindowVisibilityEvent>({ [&](const WindowVisibilityEvent& evt) { seen.push_back(evt.kState); } });
+
+    RenderThrottle throttle{};
+    throttle.Track(*first);
+    throttle.Track(*second);
+    EXPECT_DOUBLE_EQ(throttle.GetFrameInterval(1.0 / 60.0), 1.0 / 60.0);
+
+    first->InjectOcclusion(WindowVisibilityState::PartiallyObscured);
+    first->Minimize();
+    // iconified wins over the occlusion, and restoring brings it back
+    EXPECT_EQ(first->GetVisibilityState(), WindowVisibilityState::Iconified);
+    first->Restore();
+    EXPECT_EQ(first->GetVisibilityState(), WindowVisibilityState::PartiallyObscured);
+    first->InjectOcclusion(WindowVisibilityState::FullyObscured);
+    ASSERT_EQ(seen.size(), 4u);
+    EXPECT_EQ(seen[0], WindowVisibilityState::PartiallyObscured);
+    EXPECT_EQ(seen[1], WindowVisibilityState::Iconified);
+    EXPECT_EQ(seen[3], WindowVisibilityState::FullyObscured);
+    EXPECT_TRUE(throttle.IsAnythingVisible());
+
+    second->Hide();
+    EXPECT_EQ(second->GetVisibilityState(), WindowVisibilityState::FullyObscured);
+    EXPECT_FALSE(throttle.IsAnythingVisible());
+    EXPECT_DOUBLE_EQ(throttle.GetFrameInterval(1.0 / 60.0), RenderThrottle::kDefaultHiddenInterval);
+    // never faster than asked for
+    EXPECT_DOUBLE_EQ(throttle.GetFrameInterval(1.0), 1.0);
+
+    second->Show();
+    EXPECT_TRUE(throttle.IsAnythingVisible());
+    throttle.Untrack(*second);
+    EXPECT_FALSE(throttle.IsAnythingVisible());
+
+    throttle.Untrack(*first);
+    EXPECT_TRUE(throttle.IsAnythingVisible());
+    EXPECT_TRUE(manager.Terminate());
+}
+#endif
+
+#ifdef PYRO_PLATFORM_WINDOWING_XCB
+// -------- XcbWindowManager --------
+// needs an X server, Xvfb is enough
+TEST(XcbWindowManagerTest, CreatesWindowAndReadsMonitors) {
+    if (std::getenv("DISPLAY") == nullptr) {
+        GTEST_SKIP() << "DISPLAY is not set";
+    }
+    XcbWindowManager manager{};
+    if (!manager.Init()) {
+        GTEST_SKIP() << "no X server to connect to";
+    }
+    EXPECT_FALSE(manager.GetMonitors().empty());
+    EXPECT_NE(manager.GetPrimaryMonitor(), nullptr);
+
+    IWindow* window = manager.CreateWindow({ 320, 240, "Xcb" });
+    manager.PollEvents();
+    EXPECT_EQ(window->GetSize(), Size(320, 240));
+    EXPECT_EQ(window->GetTitle(), "Xcb");
+    EXPECT_FALSE(window->ShouldClose());
+
+    // answered from our own copy while we own the selection
+    manager.SetClipboardText("pyro");
+    EXPECT_TRUE(manager.HasClipboardText());
+    EXPECT_EQ(manager.GetClipboardText(), "pyro");
+
+    // MIT-SHM against a local server, PutImage otherwise
+    eastl::vector<u32> image(320 * 240, 0x336699u);
+    const WindowRect dirty[] = { { 10, 10, 64, 32 } };
+    EXPECT_TRUE(window->PresentPixels(eastl::span<const u8>(reinterpret_cast<const u8*>(image.data()), image.size() * 4), Size(320, 240), 320 * 4));
+    EXPECT_TRUE(window->PresentPixels(eastl::span<const u8>(reinterpret_cast<const u8*>(image.data()), image.size() * 4), Size(320, 240), 320 * 4, dirty));
+    manager.PollEvents();
+
+    manager.DestroyWindow(window);
+    EXPECT_EQ(window, nullptr);
+    EXPECT_TRUE(manager.Terminate());
+}
+#endif
+
+#ifdef PYRO_PLATFORM_INPUT_INSTRUMENTATION
+// -------- InputEventDispatcher --------
+TEST(InputEventDispatcherTest, ReportsSlowHandlers) {
+    ClockStub clock{};
+    gInputInstrumentation.SetClock(&clock);
+    eastl::vector<InputSlowHandler> reports{};
+    gInputInstrumentation.SetSlowHandlerBudget(1000, { [&](const InputSlowHandler& report) { reports.push_back(report); } });
+
+    InputEventDispatcher<KeyEvent> dispatcher{};
+    const u32 slowLine = __LINE__ + 1;
+    InputEventHandle<KeyEvent> slow = dispatcher.Bind({ [&](KeyEvent&) { clock.ticks += 5000; } });
+    InputEventHandle<KeyEvent> fast = dispatcher.Bind({ [&](KeyEvent&) { clock.ticks += 10; } });
+
+    KeyEvent event(gWindowStub, KeyCode::KeyA, 0, {}, true, false);
+    dispatcher.Dispatch(event);
+    dispatcher.Dispatch(event);
+
+    EXPECT_EQ(dispatcher.GetDispatchCount(), 2u);
+    EXPECT_EQ(dispatcher.GetDispatchNanoseconds(), 2u * 5010u);
+    ASSERT_NE(dispatcher.GetHandlerStats(slow), nullptr);
+    EXPECT_EQ(dispatcher.GetHandlerStats(slow)->time.GetCount(), 2u);
+    EXPECT_EQ(dispatcher.GetHandlerStats(slow)->overBudgetCount, 2u);
+    EXPECT_EQ(dispatcher.GetHandlerStats(fast)->overBudgetCount, 0u);
+
+    ASSERT_EQ(reports.size(), 2u);
+    EXPECT_EQ(reports[0].eventName, KeyEvent::kName);
+    EXPECT_EQ(reports[0].site.line(), slowLine);
+    EXPECT_EQ(reports[0].nanoseconds, 5000u);
+
+    dispatcher.ResetStats();
+    EXPECT_EQ(dispatcher.GetDispatchCount(), 0u);
+    gInputInstrumentation.ClearSlowHandlerBudget();
+    gInputInstrumentation.SetClock(nullptr);
+}
+#endif
+
+#endif